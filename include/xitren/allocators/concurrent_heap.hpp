@@ -0,0 +1,325 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/allocators/static_heap.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace xitren::allocators {
+
+/**
+ * @brief Thread-safe static_heap that keeps small blocks in per-thread magazines, so most allocations and frees
+ * touch no shared state.
+ *
+ * Requests of up to max_cached_size bytes are rounded up to a multiple of 16 and served from a magazine of the
+ * calling thread for that size class. An empty magazine is refilled, and a full one drained, by half its capacity
+ * at once under the heap lock, so the lock is taken once per batch instead of once per call. Larger requests, and
+ * threads beyond the first Threads ones, go to the heap under the lock; small requests of those threads are still
+ * rounded up to their size class, since a thread with magazines may free the block with its size.
+ *
+ * The size class of a block is only known when the size is passed back: deallocate(pointer, size) caches the
+ * block, deallocate(pointer) returns it to the heap directly. Both are correct for any block. Blocks cached by a
+ * thread count as allocated in the heap statistics; flush() returns those of the calling thread. A thread that
+ * exits leaves its magazines to the next thread that starts.
+ */
+template <std::size_t Size, heap_mode Mode = heap_mode::first_fit, std::size_t Threads = 16>
+class concurrent_heap {
+    using callback_t = std::function<void(void)>;
+
+    static constexpr std::size_t class_granularity = 16;
+    static constexpr std::size_t class_count       = 8;
+    static constexpr std::size_t magazine_capacity = 16;
+    static constexpr std::size_t batch_size        = magazine_capacity / 2;
+
+    struct magazine {
+        std::array<void*, magazine_capacity> blocks{};
+        std::size_t                          count{};
+    };
+
+    /* Aligned to a cache line, so threads never write to the same line. */
+    struct alignas(64) thread_cache {
+        std::array<magazine, class_count> magazines{};
+    };
+
+public:
+    using heap_stats_t = heap_stats;
+
+    static constexpr std::size_t max_cached_size = class_granularity * class_count;
+    static constexpr std::size_t alignment       = static_heap<Size, Mode>::alignment;
+
+    concurrent_heap() = default;
+
+    concurrent_heap(concurrent_heap const&) = delete;
+    concurrent_heap&
+    operator=(concurrent_heap const&)
+        = delete;
+
+    /**
+     * Sets a callback for failed allocations. It is called without the heap lock held, so it may free memory.
+     */
+    void
+    on_fail(callback_t callback)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        callback_ = callback;
+    }
+
+    void*
+    allocate(std::size_t size)
+    {
+        void* result = nullptr;
+        if (auto* cache = this_thread_cache(); (cache != nullptr) && (size > 0) && (size <= max_cached_size)) {
+            auto& stock = cache->magazines[size_class(size)];
+            if (stock.count == 0) {
+                refill(stock, class_size(size_class(size)));
+            }
+            if (stock.count == 0) {
+                /* The heap may be short only of the blocks this thread holds in other size classes. */
+                flush();
+                refill(stock, class_size(size_class(size)));
+            }
+            if (stock.count > 0) {
+                result = stock.blocks[--stock.count];
+            }
+        } else {
+            std::unique_lock<std::mutex> lock(access_);
+            result = heap_.allocate(rounded_size(size));
+        }
+        if (result == nullptr) {
+            fail();
+        }
+        return result;
+    }
+
+    /**
+     * Allocates a block whose address is a multiple of align. Alignments the heap gives every block are served
+     * from the magazines; larger ones come from the heap under the lock, rounded up to the size class so that a
+     * sized free can still cache the block.
+     */
+    void*
+    allocate_aligned(std::size_t size, std::size_t align)
+    {
+        if (align <= alignment) {
+            return allocate(size);
+        }
+        void* result = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(access_);
+            result = heap_.allocate_aligned(rounded_size(size), align);
+        }
+        if (result == nullptr) {
+            fail();
+        }
+        return result;
+    }
+
+    /**
+     * Returns a block of size bytes, as requested from allocate(), to the magazines of the calling thread.
+     */
+    void
+    deallocate(void* pointer, std::size_t size)
+    {
+        if (pointer == nullptr) {
+            return;
+        }
+        auto* cache = this_thread_cache();
+        if ((cache == nullptr) || (size == 0) || (size > max_cached_size)) {
+            deallocate(pointer);
+            return;
+        }
+        auto& stock = cache->magazines[size_class(size)];
+        if (stock.count == magazine_capacity) {
+            drain(stock, batch_size);
+        }
+        stock.blocks[stock.count++] = pointer;
+    }
+
+    /**
+     * Returns a block to the shared heap.
+     */
+    void
+    deallocate(void* pointer)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        heap_.deallocate(pointer);
+    }
+
+    void*
+    callocate(std::size_t num, std::size_t size)
+    {
+        if ((size != 0) && (num > std::numeric_limits<std::size_t>::max() / size)) {
+            return nullptr;
+        }
+        void* result = allocate(num * size);
+        if (result != nullptr) {
+            std::memset(result, 0, num * size);
+        }
+        return result;
+    }
+
+    /**
+     * Returns all blocks cached by the calling thread to the shared heap.
+     */
+    void
+    flush()
+    {
+        if (auto* cache = this_thread_cache(); cache != nullptr) {
+            for (auto& stock : cache->magazines) {
+                drain(stock, stock.count);
+            }
+        }
+    }
+
+    std::size_t
+    free_heap_size()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return heap_.free_heap_size();
+    }
+
+    std::size_t
+    minimum_ever_free_heap_size()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return heap_.minimum_ever_free_heap_size();
+    }
+
+    void
+    reset_minimum_ever_free_heap_size()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        heap_.reset_minimum_ever_free_heap_size();
+    }
+
+    void
+    v_port_get_heap_stats(heap_stats_t* stats)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        heap_.v_port_get_heap_stats(stats);
+    }
+
+private:
+    static_heap<Size, Mode>           heap_{};
+    std::mutex                        access_{};
+    callback_t                        callback_{nullptr};
+    std::array<thread_cache, Threads> caches_{};
+
+    static constexpr std::size_t
+    size_class(std::size_t size) noexcept
+    {
+        return (size - 1) / class_granularity;
+    }
+
+    static constexpr std::size_t
+    class_size(std::size_t index) noexcept
+    {
+        return (index + 1) * class_granularity;
+    }
+
+    /* Small requests take a whole size class on every path, as any block may end up in a magazine. */
+    static constexpr std::size_t
+    rounded_size(std::size_t size) noexcept
+    {
+        return ((size > 0) && (size <= max_cached_size)) ? class_size(size_class(size)) : size;
+    }
+
+    /* Takes batch_size blocks from the heap at once, or as many as it still has. */
+    void
+    refill(magazine& stock, std::size_t size)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        while (stock.count < batch_size) {
+            void* block = heap_.allocate(size);
+            if (block == nullptr) {
+                return;
+            }
+            stock.blocks[stock.count++] = block;
+        }
+    }
+
+    /* Returns the count blocks that were cached first. */
+    void
+    drain(magazine& stock, std::size_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+        {
+            std::unique_lock<std::mutex> lock(access_);
+            for (std::size_t i{}; i < count; i++) {
+                heap_.deallocate(stock.blocks[i]);
+            }
+        }
+        std::copy(stock.blocks.begin() + count, stock.blocks.begin() + stock.count, stock.blocks.begin());
+        stock.count -= count;
+    }
+
+    void
+    fail()
+    {
+        callback_t callback;
+        {
+            std::unique_lock<std::mutex> lock(access_);
+            callback = callback_;
+        }
+        if (callback != nullptr) {
+            callback();
+        }
+    }
+
+    thread_cache*
+    this_thread_cache()
+    {
+        auto const index = this_thread_index();
+        return (index < Threads) ? &caches_[index] : nullptr;
+    }
+
+    /* Small index of the calling thread, unique among running threads and reused after a thread exits. */
+    static std::size_t
+    this_thread_index()
+    {
+        struct registry {
+            std::mutex               access{};
+            std::vector<std::size_t> released{};
+            std::size_t              next{};
+        };
+        static registry threads;
+
+        struct thread_id {
+            std::size_t index;
+
+            thread_id()
+            {
+                std::unique_lock<std::mutex> lock(threads.access);
+                if (threads.released.empty()) {
+                    index = threads.next++;
+                } else {
+                    index = threads.released.back();
+                    threads.released.pop_back();
+                }
+            }
+
+            ~thread_id()
+            {
+                std::unique_lock<std::mutex> lock(threads.access);
+                threads.released.push_back(index);
+            }
+        };
+        thread_local thread_id id{};
+        return id.index;
+    }
+};
+
+}    // namespace xitren::allocators
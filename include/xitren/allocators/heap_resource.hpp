@@ -0,0 +1,93 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+namespace xitren::allocators {
+
+/**
+ * @brief std::pmr::memory_resource over a heap with the static_heap interface: static_heap in either mode,
+ * concurrent_heap, region_heap or profiled_heap.
+ *
+ * Containers that use std::pmr::polymorphic_allocator only see the memory_resource, so pmr::vector, pmr::string,
+ * pmr::unordered_map and the rest share one fixed-memory heap whatever its size and type, and their allocators
+ * compare equal whenever they use the same heap. A std::pmr pool resource can be stacked in front of it.
+ *
+ * The heap is referenced, not owned, and must outlive the resource. Alignments above the heap's own go to
+ * allocate_aligned(); frees pass the size on to heaps that take one, such as concurrent_heap. A failed allocation
+ * throws std::bad_alloc, after the heap's own on_fail callback. The resource is as thread-safe as the heap.
+ */
+template <class Heap>
+class heap_resource : public std::pmr::memory_resource {
+    static constexpr std::size_t heap_alignment = [] {
+        if constexpr (requires { Heap::alignment; }) {
+            return std::size_t{Heap::alignment};
+        } else {
+            return alignof(std::max_align_t);
+        }
+    }();
+
+public:
+    explicit heap_resource(Heap& heap) noexcept : heap_{heap} {}
+
+    heap_resource(heap_resource const&) = delete;
+    heap_resource&
+    operator=(heap_resource const&)
+        = delete;
+
+    Heap&
+    heap() const noexcept
+    {
+        return heap_;
+    }
+
+protected:
+    void*
+    do_allocate(std::size_t size, std::size_t alignment) override
+    {
+        /* A memory resource hands out distinct storage even for 0 bytes. */
+        size = std::max<std::size_t>(size, 1);
+
+        void* result = nullptr;
+        if (alignment <= heap_alignment) {
+            result = heap_.allocate(size);
+        } else if constexpr (requires { heap_.allocate_aligned(size, alignment); }) {
+            result = heap_.allocate_aligned(size, alignment);
+        }
+        if (result == nullptr) {
+            throw std::bad_alloc();
+        }
+        return result;
+    }
+
+    void
+    do_deallocate(void* pointer, std::size_t size, std::size_t) override
+    {
+        if constexpr (requires { heap_.deallocate(pointer, size); }) {
+            heap_.deallocate(pointer, std::max<std::size_t>(size, 1));
+        } else {
+            heap_.deallocate(pointer);
+        }
+    }
+
+    bool
+    do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        auto const* resource = dynamic_cast<heap_resource const*>(&other);
+        return (resource != nullptr) && (&resource->heap_ == &heap_);
+    }
+
+private:
+    Heap& heap_;
+};
+
+}    // namespace xitren::allocators
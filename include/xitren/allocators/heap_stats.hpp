@@ -0,0 +1,26 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <cstddef>
+
+namespace xitren::allocators {
+
+/* Used to pass information about the heap, filled by v_port_get_heap_stats() of every heap mode. Block sizes
+ * include the block headers. */
+struct heap_stats {
+    std::size_t x_available_heap_space_in_bytes;
+    std::size_t x_size_of_largest_free_block_in_bytes;
+    std::size_t x_size_of_smallest_free_block_in_bytes;
+    std::size_t x_number_of_free_blocks;
+    std::size_t x_minimum_ever_free_bytes_remaining;
+    std::size_t x_number_of_successful_allocations;
+    std::size_t x_number_of_successful_frees;
+};
+
+}    // namespace xitren::allocators
@@ -0,0 +1,152 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+
+namespace xitren::allocators {
+
+/**
+ * @brief Anonymous memory mapping to back a region_heap region, preferably with huge pages to cut TLB misses.
+ *
+ * With huge_pages set the size is rounded up to huge_page_size and the mapping first asks for explicit huge pages
+ * (MAP_HUGETLB), which only succeeds if the system has reserved them. Otherwise it maps ordinary pages aligned to
+ * huge_page_size and advises the kernel to back them with transparent huge pages. Pages are only committed when
+ * touched, so a large region costs little until the heap hands it out. A mapping that fails throws std::bad_alloc.
+ */
+class mapped_region {
+public:
+    static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+    explicit mapped_region(std::size_t size, bool huge_pages = true)
+        : size_{huge_pages ? round_up(size, huge_page_size) : size}
+    {
+        if (size_ == 0) {
+            throw std::bad_alloc();
+        }
+#ifdef MAP_HUGETLB
+        if (huge_pages) {
+            data_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (data_ != MAP_FAILED) {
+                huge_pages_ = true;
+                return;
+            }
+        }
+#endif
+        data_ = huge_pages ? map_aligned(size_, huge_page_size) : map(size_);
+        if (data_ == MAP_FAILED) {
+            data_ = nullptr;
+            throw std::bad_alloc();
+        }
+#ifdef MADV_HUGEPAGE
+        if (huge_pages) {
+            ::madvise(data_, size_, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    mapped_region(mapped_region const&) = delete;
+    mapped_region&
+    operator=(mapped_region const&)
+        = delete;
+
+    mapped_region(mapped_region&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)},
+          size_{std::exchange(other.size_, 0)},
+          huge_pages_{std::exchange(other.huge_pages_, false)}
+    {}
+
+    mapped_region&
+    operator=(mapped_region&& other) noexcept
+    {
+        if (this != &other) {
+            unmap();
+            data_       = std::exchange(other.data_, nullptr);
+            size_       = std::exchange(other.size_, 0);
+            huge_pages_ = std::exchange(other.huge_pages_, false);
+        }
+        return *this;
+    }
+
+    ~mapped_region() { unmap(); }
+
+    void*
+    data() const noexcept
+    {
+        return data_;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    /**
+     * True if the mapping has explicit huge pages; transparent huge pages are up to the kernel and not reported.
+     */
+    bool
+    huge_pages() const noexcept
+    {
+        return huge_pages_;
+    }
+
+private:
+    void*       data_{nullptr};
+    std::size_t size_{};
+    bool        huge_pages_{};
+
+    static constexpr std::size_t
+    round_up(std::size_t value, std::size_t step)
+    {
+        return (value + step - 1) / step * step;
+    }
+
+    static void*
+    map(std::size_t size)
+    {
+        return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    /* Maps size bytes at an address aligned to alignment by over-mapping and trimming both ends. */
+    static void*
+    map_aligned(std::size_t size, std::size_t alignment)
+    {
+        auto* raw = map(size + alignment);
+        if (raw == MAP_FAILED) {
+            return raw;
+        }
+        auto const address = reinterpret_cast<std::uintptr_t>(raw);
+        auto const aligned = (address + alignment - 1) & ~(alignment - 1);
+        if (aligned != address) {
+            ::munmap(raw, aligned - address);
+        }
+        if (auto const tail = address + size + alignment - (aligned + size); tail != 0) {
+            ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+        }
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void
+    unmap() noexcept
+    {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+        }
+    }
+};
+
+}    // namespace xitren::allocators
+
+#endif
@@ -0,0 +1,212 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace xitren::allocators {
+
+/**
+ * @brief Bump allocator over a static buffer of Size bytes, for objects that all die together: deallocation is a
+ * no-op and reset() frees everything at once.
+ *
+ * Allocation moves a pointer past the aligned request. When the buffer is used up, an arena with an Upstream heap
+ * (e.g. static_heap) takes a chunk from it, each one twice as large as the last, and reset() gives the chunks back.
+ * Freeing the most recent allocation with its size rolls the pointer back, so a growing vector does not waste
+ * its previous buffer.
+ *
+ * The arena offers the static_heap interface, where a failed allocate() returns nullptr, so it works with
+ * static_heap_allocator (see monotonic_arena_allocator), and it is a std::pmr::memory_resource, where a failed
+ * allocation throws std::bad_alloc. Like static_heap it is not synchronized.
+ */
+template <std::size_t Size, class Upstream = void>
+class monotonic_arena : public std::pmr::memory_resource {
+    static constexpr bool has_upstream = !std::is_void_v<Upstream>;
+
+    struct chunk {
+        chunk*      next;
+        std::size_t size;
+    };
+
+    using upstream_pointer = std::conditional_t<has_upstream, Upstream*, std::nullptr_t>;
+
+public:
+    static constexpr std::size_t default_alignment = alignof(std::max_align_t);
+
+    monotonic_arena() noexcept
+        requires(!has_upstream)
+    {}
+
+    /**
+     * @param chunk_size size of the first chunk taken from upstream once the buffer is used up.
+     */
+    template <class U = Upstream>
+        requires(!std::is_void_v<U>)
+    explicit monotonic_arena(U& upstream, std::size_t chunk_size = 4096) noexcept
+        : upstream_{&upstream}, first_chunk_size_{chunk_size}, next_chunk_size_{chunk_size}
+    {}
+
+    monotonic_arena(monotonic_arena const&) = delete;
+    monotonic_arena&
+    operator=(monotonic_arena const&)
+        = delete;
+
+    ~monotonic_arena() override { reset(); }
+
+    void*
+    allocate(std::size_t size, std::size_t alignment = default_alignment) noexcept
+    {
+        if (auto* result = bump(size, alignment); result != nullptr) {
+            return result;
+        }
+        if constexpr (has_upstream) {
+            if (grow(size, alignment)) {
+                return bump(size, alignment);
+            }
+        }
+        return nullptr;
+    }
+
+    void*
+    allocate_aligned(std::size_t size, std::size_t alignment) noexcept
+    {
+        return allocate(size, alignment);
+    }
+
+    /**
+     * Does nothing, memory is reclaimed by reset().
+     */
+    void
+    deallocate(void*) noexcept
+    {}
+
+    /**
+     * Rolls back the most recent allocation, if pointer is that allocation, and otherwise does nothing.
+     */
+    void
+    deallocate(void* pointer, std::size_t size) noexcept
+    {
+        if ((pointer != nullptr) && (static_cast<std::byte*>(pointer) + size == current_)) {
+            current_ = static_cast<std::byte*>(pointer);
+            used_ -= size;
+        }
+    }
+
+    /**
+     * Frees everything allocated so far: returns the chunks to upstream and starts over at the buffer.
+     */
+    void
+    reset() noexcept
+    {
+        if constexpr (has_upstream) {
+            while (chunks_ != nullptr) {
+                auto* next = chunks_->next;
+                upstream_->deallocate(chunks_);
+                chunks_ = next;
+            }
+            next_chunk_size_ = first_chunk_size_;
+        }
+        current_ = buffer_.data();
+        end_     = buffer_.data() + Size;
+        used_    = 0;
+    }
+
+    /**
+     * Bytes handed out since the last reset().
+     */
+    std::size_t
+    used() const noexcept
+    {
+        return used_;
+    }
+
+    /**
+     * Bytes left before the arena needs a new chunk.
+     */
+    std::size_t
+    free_heap_size() const noexcept
+    {
+        return static_cast<std::size_t>(end_ - current_);
+    }
+
+protected:
+    void*
+    do_allocate(std::size_t size, std::size_t alignment) override
+    {
+        if (auto* result = allocate(size, alignment); result != nullptr) {
+            return result;
+        }
+        throw std::bad_alloc();
+    }
+
+    void
+    do_deallocate(void* pointer, std::size_t size, std::size_t) override
+    {
+        deallocate(pointer, size);
+    }
+
+    bool
+    do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, Size> buffer_{};
+    std::byte*       current_{buffer_.data()};
+    std::byte*       end_{buffer_.data() + Size};
+    std::size_t      used_{};
+    chunk*           chunks_{nullptr};
+    upstream_pointer upstream_{nullptr};
+    std::size_t      first_chunk_size_{};
+    std::size_t      next_chunk_size_{};
+
+    void*
+    bump(std::size_t size, std::size_t alignment) noexcept
+    {
+        auto const address = reinterpret_cast<std::uintptr_t>(current_);
+        auto const aligned = (address + alignment - 1) & ~(alignment - 1);
+        auto const end     = reinterpret_cast<std::uintptr_t>(end_);
+        if ((aligned > end) || (size > end - aligned)) {
+            return nullptr;
+        }
+        current_ = reinterpret_cast<std::byte*>(aligned + size);
+        used_ += size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /* Takes a chunk large enough for the request from upstream and continues in it. */
+    bool
+    grow(std::size_t size, std::size_t alignment) noexcept
+    {
+        if (size > std::numeric_limits<std::size_t>::max() / 2 - sizeof(chunk) - alignment) {
+            return false;
+        }
+        auto const bytes = std::max(next_chunk_size_, sizeof(chunk) + size + alignment);
+        auto*      block = static_cast<chunk*>(upstream_->allocate(bytes));
+        if (block == nullptr) {
+            return false;
+        }
+        block->next      = chunks_;
+        block->size      = bytes;
+        chunks_          = block;
+        current_         = reinterpret_cast<std::byte*>(block + 1);
+        end_             = reinterpret_cast<std::byte*>(block) + bytes;
+        next_chunk_size_ = std::min(next_chunk_size_ * 2, std::numeric_limits<std::size_t>::max() / 2);
+        return true;
+    }
+};
+
+}    // namespace xitren::allocators
@@ -0,0 +1,446 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/allocators/heap_stats.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace xitren::allocators {
+
+/**
+ * @brief Heap wrapper that profiles every allocation made through it, to size a heap and choose pool classes from
+ * measured data.
+ *
+ * It owns a Heap (static_heap in any mode, region_heap, concurrent_heap...) with the same interface, so it can be
+ * the Heap of static_heap_allocator, and records:
+ *  - live blocks, live bytes and their high-water marks per power-of-two size class of the requested size;
+ *  - a histogram of the time allocate() takes, in power-of-two buckets of Clock nanoseconds;
+ *  - the fragmentation index of the heap, 1 - largest free block / free bytes;
+ *  - live and peak bytes per call-site tag, up to Tags tags, set for a scope with tag_scope.
+ * dump() writes all of it as text.
+ *
+ * The requested size and tag are kept in a header of header_size bytes in front of each block, so the profile
+ * costs that much heap per block and the numbers of the Heap itself include it; blocks must be freed through the
+ * wrapper. Like static_heap it is not synchronized, even around a concurrent_heap.
+ */
+template <class Heap, class Clock = std::chrono::steady_clock, std::size_t Tags = 16>
+class profiled_heap {
+    struct block_header {
+        std::size_t   size;
+        std::uint32_t offset;
+        std::uint32_t tag;
+    };
+
+    static constexpr std::size_t heap_alignment = [] {
+        if constexpr (requires { Heap::alignment; }) {
+            return std::size_t{Heap::alignment};
+        } else {
+            return alignof(std::max_align_t);
+        }
+    }();
+
+    static_assert(Tags >= 1, "The first tag stands for untagged allocations");
+
+public:
+    using heap_stats_t = heap_stats;
+
+    static constexpr std::size_t alignment       = heap_alignment;
+    static constexpr std::size_t header_size     = std::max(sizeof(block_header), heap_alignment);
+    static constexpr std::size_t size_classes    = 32;
+    static constexpr std::size_t latency_buckets = 32;
+
+    struct size_class_stats {
+        std::size_t allocations;
+        std::size_t live_blocks;
+        std::size_t live_bytes;
+        std::size_t peak_blocks;
+        std::size_t peak_bytes;
+    };
+
+    struct tag_stats {
+        std::string_view name;
+        std::size_t      allocations;
+        std::size_t      live_blocks;
+        std::size_t      live_bytes;
+        std::size_t      peak_bytes;
+    };
+
+    /**
+     * Tags the allocations made while it is alive, then restores the previous tag. name must outlive the heap,
+     * as a string literal does.
+     */
+    class tag_scope {
+    public:
+        tag_scope(profiled_heap& heap, std::string_view name) : heap_{heap}, previous_{heap.current_tag_}
+        {
+            heap_.current_tag_ = heap_.tag_index(name);
+        }
+
+        tag_scope(tag_scope const&) = delete;
+        tag_scope&
+        operator=(tag_scope const&)
+            = delete;
+
+        ~tag_scope() { heap_.current_tag_ = previous_; }
+
+    private:
+        profiled_heap& heap_;
+        std::uint32_t  previous_;
+    };
+
+    profiled_heap() { tags_[0].name = "untagged"; }
+
+    profiled_heap(profiled_heap const&) = delete;
+    profiled_heap&
+    operator=(profiled_heap const&)
+        = delete;
+
+    template <class Callback>
+    void
+    on_fail(Callback callback)
+    {
+        heap_.on_fail(callback);
+    }
+
+    void*
+    allocate(std::size_t size)
+    {
+        return allocate_aligned(size, heap_alignment);
+    }
+
+    void*
+    allocate_aligned(std::size_t size, std::size_t align)
+    {
+        /* Over-aligned blocks keep their header in the first align bytes, so the payload stays aligned. */
+        auto const offset = std::max(header_size, align);
+        if ((size == 0) || (size > std::numeric_limits<std::size_t>::max() - offset)) {
+            failed_allocations_++;
+            return nullptr;
+        }
+
+        auto const begin = Clock::now();
+        void*      raw   = (align <= heap_alignment) ? heap_.allocate(size + offset)
+                                                     : heap_.allocate_aligned(size + offset, align);
+        auto const end   = Clock::now();
+
+        latency_[latency_bucket(end - begin)]++;
+
+        if (raw == nullptr) {
+            failed_allocations_++;
+            return nullptr;
+        }
+        auto* pointer = static_cast<std::uint8_t*>(raw) + offset;
+        block_header const header{size, static_cast<std::uint32_t>(offset), current_tag_};
+        std::memcpy(pointer - sizeof(block_header), &header, sizeof(block_header));
+        record_allocation(header);
+        return pointer;
+    }
+
+    void
+    deallocate(void* pointer)
+    {
+        if (pointer != nullptr) {
+            heap_.deallocate(release(pointer).first);
+        }
+    }
+
+    /**
+     * Sized free, passed on to heaps that take one.
+     */
+    void
+    deallocate(void* pointer, std::size_t size)
+    {
+        if (pointer == nullptr) {
+            return;
+        }
+        auto const [raw, offset] = release(pointer);
+        if constexpr (requires(void* block, std::size_t bytes) { heap_.deallocate(block, bytes); }) {
+            heap_.deallocate(raw, size + offset);
+        } else {
+            heap_.deallocate(raw);
+        }
+    }
+
+    void*
+    callocate(std::size_t num, std::size_t size)
+    {
+        if ((size != 0) && (num > std::numeric_limits<std::size_t>::max() / size)) {
+            return nullptr;
+        }
+        void* result = allocate(num * size);
+        if (result != nullptr) {
+            std::memset(result, 0, num * size);
+        }
+        return result;
+    }
+
+    std::size_t
+    free_heap_size()
+    {
+        return heap_.free_heap_size();
+    }
+
+    std::size_t
+    minimum_ever_free_heap_size()
+    {
+        return heap_.minimum_ever_free_heap_size();
+    }
+
+    void
+    reset_minimum_ever_free_heap_size()
+    {
+        heap_.reset_minimum_ever_free_heap_size();
+    }
+
+    void
+    v_port_get_heap_stats(heap_stats_t* stats)
+    {
+        heap_.v_port_get_heap_stats(stats);
+    }
+
+    /**
+     * The wrapped heap, for calls beyond the common interface such as region_heap::add_region().
+     */
+    Heap&
+    heap() noexcept
+    {
+        return heap_;
+    }
+
+    /**
+     * Size class of a requested size: class 0 holds 1 byte, class i sizes above 2^(i-1) up to 2^i, and the last
+     * class everything larger.
+     */
+    static constexpr std::size_t
+    size_class_of(std::size_t size) noexcept
+    {
+        return std::min(static_cast<std::size_t>(std::bit_width(size - 1)), size_classes - 1);
+    }
+
+    std::span<size_class_stats const, size_classes>
+    size_histogram() const noexcept
+    {
+        return classes_;
+    }
+
+    /**
+     * Bucket i counts allocations that took [2^(i-1), 2^i) nanoseconds, bucket 0 those under one.
+     */
+    std::span<std::size_t const, latency_buckets>
+    latency_histogram() const noexcept
+    {
+        return latency_;
+    }
+
+    /**
+     * The tags seen so far; the first one counts untagged allocations and those beyond Tags distinct tags.
+     */
+    std::span<tag_stats const>
+    tags() const noexcept
+    {
+        return {tags_.data(), tag_count_};
+    }
+
+    std::size_t
+    live_bytes() const noexcept
+    {
+        return live_bytes_;
+    }
+
+    std::size_t
+    peak_live_bytes() const noexcept
+    {
+        return peak_live_bytes_;
+    }
+
+    std::size_t
+    failed_allocations() const noexcept
+    {
+        return failed_allocations_;
+    }
+
+    /**
+     * 0 when the free space is one block, approaching 1 as it is split into ever smaller ones.
+     */
+    double
+    fragmentation()
+    {
+        heap_stats_t stats{};
+        heap_.v_port_get_heap_stats(&stats);
+        if (stats.x_available_heap_space_in_bytes == 0) {
+            return 0.0;
+        }
+        return 1.0
+               - static_cast<double>(std::min(stats.x_size_of_largest_free_block_in_bytes,
+                                              stats.x_available_heap_space_in_bytes))
+                     / static_cast<double>(stats.x_available_heap_space_in_bytes);
+    }
+
+    /**
+     * Clears the counters and latencies and lowers the high-water marks to what is live now.
+     */
+    void
+    reset_profile() noexcept
+    {
+        for (auto& entry : classes_) {
+            entry.allocations = 0;
+            entry.peak_blocks = entry.live_blocks;
+            entry.peak_bytes  = entry.live_bytes;
+        }
+        for (std::size_t i{}; i < tag_count_; i++) {
+            tags_[i].allocations = 0;
+            tags_[i].peak_bytes  = tags_[i].live_bytes;
+        }
+        latency_.fill(0);
+        peak_live_bytes_    = live_bytes_;
+        failed_allocations_ = 0;
+    }
+
+    /**
+     * Writes the heap statistics and every non-empty row of the profile as text.
+     */
+    void
+    dump(std::ostream& out)
+    {
+        auto const   flags     = out.flags();
+        auto const   precision = out.precision();
+        heap_stats_t stats{};
+        heap_.v_port_get_heap_stats(&stats);
+        out << "heap: " << stats.x_available_heap_space_in_bytes << " B free, "
+            << stats.x_minimum_ever_free_bytes_remaining << " B minimum ever free, "
+            << stats.x_size_of_largest_free_block_in_bytes << " B largest free block in "
+            << stats.x_number_of_free_blocks << " blocks, fragmentation " << std::fixed << std::setprecision(3)
+            << fragmentation() << "\n";
+        out << "live: " << live_bytes_ << " B, peak " << peak_live_bytes_ << " B, " << failed_allocations_
+            << " failed allocations\n";
+
+        int const width = 14;
+        out << std::setw(width) << "size <=" << std::setw(width) << "allocations" << std::setw(width) << "live"
+            << std::setw(width) << "live B" << std::setw(width) << "peak" << std::setw(width) << "peak B" << "\n";
+        for (std::size_t i{}; i < size_classes; i++) {
+            auto const& entry = classes_[i];
+            if ((entry.allocations == 0) && (entry.peak_blocks == 0)) {
+                continue;
+            }
+            if (i + 1 < size_classes) {
+                out << std::setw(width) << (std::size_t{1} << i);
+            } else {
+                out << std::setw(width) << "larger";
+            }
+            out << std::setw(width) << entry.allocations << std::setw(width) << entry.live_blocks << std::setw(width)
+                << entry.live_bytes << std::setw(width) << entry.peak_blocks << std::setw(width) << entry.peak_bytes
+                << "\n";
+        }
+
+        out << std::setw(width) << "ns <" << std::setw(width) << "allocations" << "\n";
+        for (std::size_t i{}; i < latency_buckets; i++) {
+            if (latency_[i] != 0) {
+                out << std::setw(width) << (std::uint64_t{1} << i) << std::setw(width) << latency_[i] << "\n";
+            }
+        }
+
+        out << std::setw(width) << "tag" << std::setw(width) << "allocations" << std::setw(width) << "live"
+            << std::setw(width) << "live B" << std::setw(width) << "peak B" << "\n";
+        for (auto const& entry : tags()) {
+            out << std::setw(width) << entry.name << std::setw(width) << entry.allocations << std::setw(width)
+                << entry.live_blocks << std::setw(width) << entry.live_bytes << std::setw(width) << entry.peak_bytes
+                << "\n";
+        }
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+private:
+    Heap                                       heap_{};
+    std::array<size_class_stats, size_classes> classes_{};
+    std::array<std::size_t, latency_buckets>   latency_{};
+    std::array<tag_stats, Tags>                tags_{};
+    std::size_t                                tag_count_{1};
+    std::uint32_t                              current_tag_{};
+    std::size_t                                live_bytes_{};
+    std::size_t                                peak_live_bytes_{};
+    std::size_t                                failed_allocations_{};
+
+    static std::size_t
+    latency_bucket(typename Clock::duration elapsed) noexcept
+    {
+        auto const nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        if (nanoseconds <= 0) {
+            return 0;
+        }
+        return std::min(static_cast<std::size_t>(std::bit_width(static_cast<std::uint64_t>(nanoseconds))),
+                        latency_buckets - 1);
+    }
+
+    std::uint32_t
+    tag_index(std::string_view name)
+    {
+        for (std::size_t i = 1; i < tag_count_; i++) {
+            if (tags_[i].name == name) {
+                return static_cast<std::uint32_t>(i);
+            }
+        }
+        if (tag_count_ == Tags) {
+            return 0;
+        }
+        tags_[tag_count_].name = name;
+        return static_cast<std::uint32_t>(tag_count_++);
+    }
+
+    void
+    record_allocation(block_header const& header)
+    {
+        auto& entry = classes_[size_class_of(header.size)];
+        entry.allocations++;
+        entry.live_blocks++;
+        entry.live_bytes += header.size;
+        entry.peak_blocks = std::max(entry.peak_blocks, entry.live_blocks);
+        entry.peak_bytes  = std::max(entry.peak_bytes, entry.live_bytes);
+
+        auto& tag = tags_[header.tag];
+        tag.allocations++;
+        tag.live_blocks++;
+        tag.live_bytes += header.size;
+        tag.peak_bytes = std::max(tag.peak_bytes, tag.live_bytes);
+
+        live_bytes_ += header.size;
+        peak_live_bytes_ = std::max(peak_live_bytes_, live_bytes_);
+    }
+
+    /* Books the block out of the profile and returns the address and header offset it was allocated with. */
+    std::pair<void*, std::size_t>
+    release(void* pointer)
+    {
+        auto*        payload = static_cast<std::uint8_t*>(pointer);
+        block_header header{};
+        std::memcpy(&header, payload - sizeof(block_header), sizeof(block_header));
+
+        auto& entry = classes_[size_class_of(header.size)];
+        entry.live_blocks--;
+        entry.live_bytes -= header.size;
+        auto& tag = tags_[header.tag];
+        tag.live_blocks--;
+        tag.live_bytes -= header.size;
+        live_bytes_ -= header.size;
+        return {payload - header.offset, header.offset};
+    }
+};
+
+}    // namespace xitren::allocators
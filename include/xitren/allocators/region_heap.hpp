@@ -0,0 +1,408 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/allocators/heap_stats.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace xitren::allocators {
+
+/**
+ * @brief First-fit heap over up to MaxRegions memory regions supplied by the caller, in the manner of FreeRTOS
+ * heap_5: static buffers, mapped_region memory or anything else the heap does not own.
+ *
+ * All regions share one address-ordered free list with the coalescing of static_heap. Every region ends in a
+ * zero-sized marker block that links it to the next region, so blocks of different regions are never merged, and
+ * regions can be added at runtime in any address order, for instance from the on_fail() callback. Besides the
+ * heap_stats of the whole heap, v_port_get_region_stats() reports every region on its own.
+ *
+ * Blocks are aligned to Alignment bytes. Like static_heap the heap is not synchronized.
+ */
+template <std::size_t MaxRegions = 8, std::size_t Alignment = 8>
+class region_heap {
+    using callback_t = std::function<void(void)>;
+
+    using block_link_t = struct a_block_link {
+        struct a_block_link* px_next_free_block; /**< The next free block in the list. */
+        std::size_t          x_block_size;       /**< The size of the free block. */
+    };
+
+    struct heap_region {
+        std::uintptr_t ux_start_address;
+        std::uintptr_t ux_end_address;
+        std::size_t    x_free_bytes_remaining;
+        std::size_t    x_minimum_ever_free_bytes_remaining;
+        std::size_t    x_number_of_successful_allocations;
+        std::size_t    x_number_of_successful_frees;
+    };
+
+    static constexpr std::size_t port_byte_alignment      = Alignment;
+    static constexpr std::size_t port_byte_alignment_mask = port_byte_alignment - 1;
+
+    static_assert(std::has_single_bit(Alignment) && (Alignment >= alignof(block_link_t)),
+                  "Alignment must be a power of two of at least the alignment of a pointer");
+
+    static constexpr std::size_t x_heap_struct_size
+        = (sizeof(block_link_t) + port_byte_alignment_mask) & ~port_byte_alignment_mask;
+    static constexpr std::size_t heap_minimum_block_size      = x_heap_struct_size << 1;
+    static constexpr std::size_t heap_size_max                = ~std::size_t{0};
+    static constexpr std::size_t heap_block_allocated_bitmask = std::size_t{1} << (sizeof(std::size_t) * 8 - 1);
+
+public:
+    using heap_stats_t = heap_stats;
+
+    static constexpr std::size_t alignment = Alignment;
+
+    region_heap() = default;
+
+    region_heap(region_heap const&) = delete;
+    region_heap&
+    operator=(region_heap const&)
+        = delete;
+
+    void
+    on_fail(callback_t callback)
+    {
+        callback_ = callback;
+    }
+
+    /**
+     * Adds x_size bytes at pv_start to the heap. The memory must stay valid for the lifetime of the heap.
+     * @return false when all MaxRegions are in use, the region overlaps another one or is too small for a block.
+     */
+    bool
+    add_region(void* pv_start, std::size_t x_size)
+    {
+        auto const ux_address = reinterpret_cast<std::uintptr_t>(pv_start);
+        if ((x_region_count_ == MaxRegions) || (pv_start == nullptr) || (x_size < 2 * heap_minimum_block_size)
+            || (x_size > heap_size_max - ux_address)) {
+            return false;
+        }
+        for (std::size_t x_region{}; x_region < x_region_count_; x_region++) {
+            auto const& region = x_regions_[x_region];
+            if ((ux_address < region.ux_end_address + x_heap_struct_size)
+                && (region.ux_start_address < ux_address + x_size)) {
+                return false;
+            }
+        }
+
+        /* The region loses the space needed to align its start and the marker block at its end. */
+        auto const ux_start_address = (ux_address + port_byte_alignment_mask) & ~port_byte_alignment_mask;
+        auto const ux_end_address   = (ux_address + x_size - x_heap_struct_size) & ~port_byte_alignment_mask;
+        if ((ux_end_address < ux_start_address) || (ux_end_address - ux_start_address <= heap_minimum_block_size)) {
+            return false;
+        }
+
+        auto* px_first_free_block = reinterpret_cast<block_link_t*>(ux_start_address);
+        auto* px_marker           = reinterpret_cast<block_link_t*>(ux_end_address);
+        auto  x_block_size        = static_cast<std::size_t>(ux_end_address - ux_start_address);
+
+        block_link_t* px_iterator = &x_start_;
+        while ((px_iterator->px_next_free_block != nullptr)
+               && (px_iterator->px_next_free_block < px_first_free_block)) {
+            px_iterator = px_iterator->px_next_free_block;
+        }
+        px_first_free_block->x_block_size       = x_block_size;
+        px_first_free_block->px_next_free_block = px_marker;
+        px_marker->x_block_size                 = 0;
+        px_marker->px_next_free_block           = px_iterator->px_next_free_block;
+        px_iterator->px_next_free_block         = px_first_free_block;
+        if (px_marker->px_next_free_block == nullptr) {
+            px_end_ = px_marker;
+        }
+
+        x_regions_[x_region_count_++] = {ux_start_address, ux_end_address, x_block_size, x_block_size, 0, 0};
+        x_free_bytes_remaining_ += x_block_size;
+        x_minimum_ever_free_bytes_remaining_ += x_block_size;
+        return true;
+    }
+
+    void*
+    allocate(std::size_t x_wanted_size)
+    {
+        void* pv_return = nullptr;
+
+        x_wanted_size = block_size_for(x_wanted_size);
+        if ((x_wanted_size > 0) && ((x_wanted_size & heap_block_allocated_bitmask) == 0)
+            && (x_wanted_size <= x_free_bytes_remaining_)) {
+            /* Walk the list from the lowest address until a block of adequate size is found; the marker blocks
+             * have a size of 0 and are passed over. */
+            block_link_t* px_previous_block = &x_start_;
+            block_link_t* px_block          = x_start_.px_next_free_block;
+            while ((px_block->x_block_size < x_wanted_size) && (px_block->px_next_free_block != nullptr)) {
+                px_previous_block = px_block;
+                px_block          = px_block->px_next_free_block;
+            }
+
+            if (px_block != px_end_) {
+                pv_return                             = reinterpret_cast<std::uint8_t*>(px_block) + x_heap_struct_size;
+                px_previous_block->px_next_free_block = px_block->px_next_free_block;
+
+                if ((px_block->x_block_size - x_wanted_size) > heap_minimum_block_size) {
+                    auto* px_new_block_link
+                        = reinterpret_cast<block_link_t*>(reinterpret_cast<std::uint8_t*>(px_block) + x_wanted_size);
+                    px_new_block_link->x_block_size       = px_block->x_block_size - x_wanted_size;
+                    px_block->x_block_size                = x_wanted_size;
+                    px_new_block_link->px_next_free_block = px_previous_block->px_next_free_block;
+                    px_previous_block->px_next_free_block = px_new_block_link;
+                }
+
+                auto& region = *region_of(px_block);
+                region.x_free_bytes_remaining -= px_block->x_block_size;
+                region.x_minimum_ever_free_bytes_remaining
+                    = std::min(region.x_minimum_ever_free_bytes_remaining, region.x_free_bytes_remaining);
+                region.x_number_of_successful_allocations++;
+
+                x_free_bytes_remaining_ -= px_block->x_block_size;
+                x_minimum_ever_free_bytes_remaining_
+                    = std::min(x_minimum_ever_free_bytes_remaining_, x_free_bytes_remaining_);
+                x_number_of_successful_allocations_++;
+
+                px_block->x_block_size |= heap_block_allocated_bitmask;
+                px_block->px_next_free_block = nullptr;
+            }
+        }
+
+        if ((pv_return == nullptr) && (callback_ != nullptr)) {
+            callback_();
+        }
+        return pv_return;
+    }
+
+    /**
+     * Allocates a block whose address is a multiple of x_alignment, as static_heap::allocate_aligned().
+     */
+    void*
+    allocate_aligned(std::size_t x_wanted_size, std::size_t x_alignment)
+    {
+        if (x_alignment <= port_byte_alignment) {
+            return allocate(x_wanted_size);
+        }
+        std::size_t const x_padding = x_alignment + heap_minimum_block_size;
+        if ((x_wanted_size == 0) || (x_wanted_size > heap_size_max - x_padding)) {
+            /* Fails the way allocate() does, callback included. */
+            return allocate(0);
+        }
+
+        auto* puc = static_cast<std::uint8_t*>(allocate(x_wanted_size + x_padding));
+        if ((puc == nullptr) || ((reinterpret_cast<std::uintptr_t>(puc) & (x_alignment - 1)) == 0)) {
+            return puc;
+        }
+
+        auto const ux_aligned_address
+            = (reinterpret_cast<std::uintptr_t>(puc) + heap_minimum_block_size + x_alignment - 1) & ~(x_alignment - 1);
+        auto const x_gap = static_cast<std::size_t>(ux_aligned_address - reinterpret_cast<std::uintptr_t>(puc));
+
+        auto* px_block         = reinterpret_cast<block_link_t*>(puc - x_heap_struct_size);
+        auto* px_aligned_block = reinterpret_cast<block_link_t*>(ux_aligned_address - x_heap_struct_size);
+
+        /* The aligned block takes the rest of the allocated one, the front is freed. */
+        px_aligned_block->x_block_size
+            = ((px_block->x_block_size & ~heap_block_allocated_bitmask) - x_gap) | heap_block_allocated_bitmask;
+        px_aligned_block->px_next_free_block = nullptr;
+
+        px_block->x_block_size = x_gap;
+        region_of(px_block)->x_free_bytes_remaining += x_gap;
+        x_free_bytes_remaining_ += x_gap;
+        prv_insert_block_into_free_list(px_block);
+
+        return reinterpret_cast<void*>(ux_aligned_address);
+    }
+
+    /**
+     * Returns a block to the free list of its region. nullptr, pointers outside every region and blocks that are
+     * already free are ignored.
+     */
+    void
+    deallocate(void* pv)
+    {
+        if (pv == nullptr) {
+            return;
+        }
+        auto* px_link = reinterpret_cast<block_link_t*>(static_cast<std::uint8_t*>(pv) - x_heap_struct_size);
+        auto* region  = region_of(px_link);
+        if ((region == nullptr) || ((px_link->x_block_size & heap_block_allocated_bitmask) == 0)
+            || (px_link->px_next_free_block != nullptr)) {
+            return;
+        }
+
+        px_link->x_block_size &= ~heap_block_allocated_bitmask;
+        region->x_free_bytes_remaining += px_link->x_block_size;
+        region->x_number_of_successful_frees++;
+        x_free_bytes_remaining_ += px_link->x_block_size;
+        x_number_of_successful_frees_++;
+        prv_insert_block_into_free_list(px_link);
+    }
+
+    void*
+    callocate(std::size_t x_num, std::size_t x_size)
+    {
+        if ((x_size != 0) && (x_num > heap_size_max / x_size)) {
+            return nullptr;
+        }
+        void* pv = allocate(x_num * x_size);
+        if (pv != nullptr) {
+            std::memset(pv, 0, x_num * x_size);
+        }
+        return pv;
+    }
+
+    std::size_t
+    region_count() const
+    {
+        return x_region_count_;
+    }
+
+    std::size_t
+    free_heap_size() const
+    {
+        return x_free_bytes_remaining_;
+    }
+
+    std::size_t
+    minimum_ever_free_heap_size() const
+    {
+        return x_minimum_ever_free_bytes_remaining_;
+    }
+
+    void
+    reset_minimum_ever_free_heap_size()
+    {
+        x_minimum_ever_free_bytes_remaining_ = x_free_bytes_remaining_;
+        for (std::size_t x_region{}; x_region < x_region_count_; x_region++) {
+            x_regions_[x_region].x_minimum_ever_free_bytes_remaining = x_regions_[x_region].x_free_bytes_remaining;
+        }
+    }
+
+    void
+    v_port_get_heap_stats(heap_stats_t* px_heap_stats) const
+    {
+        collect_free_blocks(px_heap_stats, 0, heap_size_max);
+        px_heap_stats->x_available_heap_space_in_bytes     = x_free_bytes_remaining_;
+        px_heap_stats->x_minimum_ever_free_bytes_remaining = x_minimum_ever_free_bytes_remaining_;
+        px_heap_stats->x_number_of_successful_allocations  = x_number_of_successful_allocations_;
+        px_heap_stats->x_number_of_successful_frees        = x_number_of_successful_frees_;
+    }
+
+    /**
+     * Statistics of the region added x_region-th, counting from 0.
+     * @return false if there is no such region.
+     */
+    bool
+    v_port_get_region_stats(std::size_t x_region, heap_stats_t* px_heap_stats) const
+    {
+        if (x_region >= x_region_count_) {
+            return false;
+        }
+        auto const& region = x_regions_[x_region];
+        collect_free_blocks(px_heap_stats, region.ux_start_address, region.ux_end_address);
+        px_heap_stats->x_available_heap_space_in_bytes     = region.x_free_bytes_remaining;
+        px_heap_stats->x_minimum_ever_free_bytes_remaining = region.x_minimum_ever_free_bytes_remaining;
+        px_heap_stats->x_number_of_successful_allocations  = region.x_number_of_successful_allocations;
+        px_heap_stats->x_number_of_successful_frees        = region.x_number_of_successful_frees;
+        return true;
+    }
+
+private:
+    callback_t callback_{nullptr};
+
+    /* The list starts at x_start_ and ends at the marker of the region with the highest address. */
+    block_link_t  x_start_{};
+    block_link_t* px_end_{nullptr};
+
+    std::array<heap_region, MaxRegions> x_regions_{};
+    std::size_t                         x_region_count_{};
+
+    std::size_t x_free_bytes_remaining_{};
+    std::size_t x_minimum_ever_free_bytes_remaining_{};
+    std::size_t x_number_of_successful_allocations_{};
+    std::size_t x_number_of_successful_frees_{};
+
+    /* Size of the block holding x_wanted_size bytes and its header, or 0 if there is no such size. */
+    static constexpr std::size_t
+    block_size_for(std::size_t x_wanted_size)
+    {
+        if ((x_wanted_size == 0) || (x_wanted_size > heap_size_max - x_heap_struct_size - port_byte_alignment_mask)) {
+            return 0;
+        }
+        return (x_wanted_size + x_heap_struct_size + port_byte_alignment_mask) & ~port_byte_alignment_mask;
+    }
+
+    heap_region*
+    region_of(void const* pv)
+    {
+        auto const ux_address = reinterpret_cast<std::uintptr_t>(pv);
+        for (std::size_t x_region{}; x_region < x_region_count_; x_region++) {
+            if ((ux_address >= x_regions_[x_region].ux_start_address)
+                && (ux_address < x_regions_[x_region].ux_end_address)) {
+                return &x_regions_[x_region];
+            }
+        }
+        return nullptr;
+    }
+
+    void
+    prv_insert_block_into_free_list(block_link_t* px_block_to_insert)
+    {
+        block_link_t* px_iterator = &x_start_;
+        while (px_iterator->px_next_free_block < px_block_to_insert) {
+            px_iterator = px_iterator->px_next_free_block;
+        }
+
+        /* Merge with the block in front of it, if they are contiguous. */
+        auto* puc = reinterpret_cast<std::uint8_t*>(px_iterator);
+        if ((puc + px_iterator->x_block_size) == reinterpret_cast<std::uint8_t*>(px_block_to_insert)) {
+            px_iterator->x_block_size += px_block_to_insert->x_block_size;
+            px_block_to_insert = px_iterator;
+        }
+
+        /* Merge with the block behind it, unless that is the marker at the end of the region. */
+        auto* px_next = px_iterator->px_next_free_block;
+        puc           = reinterpret_cast<std::uint8_t*>(px_block_to_insert);
+        if (((puc + px_block_to_insert->x_block_size) == reinterpret_cast<std::uint8_t*>(px_next))
+            && (px_next->x_block_size != 0)) {
+            px_block_to_insert->x_block_size += px_next->x_block_size;
+            px_block_to_insert->px_next_free_block = px_next->px_next_free_block;
+        } else {
+            px_block_to_insert->px_next_free_block = px_next;
+        }
+
+        if (px_iterator != px_block_to_insert) {
+            px_iterator->px_next_free_block = px_block_to_insert;
+        }
+    }
+
+    /* Counts the free blocks that start in [ux_start_address, ux_end_address). */
+    void
+    collect_free_blocks(heap_stats_t* px_heap_stats, std::uintptr_t ux_start_address,
+                        std::uintptr_t ux_end_address) const
+    {
+        std::size_t x_blocks{}, x_max_size{}, x_min_size{};
+        for (auto const* px_block = x_start_.px_next_free_block; px_block != nullptr;
+             px_block             = px_block->px_next_free_block) {
+            auto const ux_address = reinterpret_cast<std::uintptr_t>(px_block);
+            if ((px_block->x_block_size == 0) || (ux_address < ux_start_address) || (ux_address >= ux_end_address)) {
+                continue;
+            }
+            x_max_size = std::max(x_max_size, px_block->x_block_size);
+            x_min_size = (x_blocks == 0) ? px_block->x_block_size : std::min(x_min_size, px_block->x_block_size);
+            x_blocks++;
+        }
+        px_heap_stats->x_size_of_largest_free_block_in_bytes  = x_max_size;
+        px_heap_stats->x_size_of_smallest_free_block_in_bytes = x_min_size;
+        px_heap_stats->x_number_of_free_blocks                = x_blocks;
+    }
+};
+
+}    // namespace xitren::allocators
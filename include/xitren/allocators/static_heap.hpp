@@ -6,16 +6,27 @@ __ _(_) |_ _ _ ___ _ _
 * @date 20.01.2025
 */
 #pragma once
+#include <xitren/allocators/heap_stats.hpp>
+#include <xitren/allocators/tlsf_heap.hpp>
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 
 namespace xitren::allocators {
 
-template <std::size_t Size>
+/* Allocation strategy of static_heap: heap_4 style first fit over an address-ordered free list, which is compact
+ * but walks the list on every allocate and deallocate, or TLSF with bounded O(1) operations. */
+enum class heap_mode { first_fit, tlsf };
+
+/**
+ * Blocks are aligned to Alignment bytes, a power of two of at least 8; every block header is padded to it as well.
+ * allocate_aligned() serves larger alignments one block at a time.
+ */
+template <std::size_t Size, heap_mode Mode = heap_mode::first_fit, std::size_t Alignment = 8>
 class static_heap {
     static const std::size_t config_total_heap_size = Size;
 
@@ -28,40 +39,12 @@ class static_heap {
         size_t               x_block_size;       /**< The size of the free block. */
     };
 
-    /* Used to pass information about the heap. */
-    using heap_stats_t = struct {
-        size_t x_available_heap_space_in_bytes;
-        size_t x_size_of_largest_free_block_in_bytes;
-        size_t x_size_of_smallest_free_block_in_bytes;
-        size_t x_number_of_free_blocks;
-        size_t x_minimum_ever_free_bytes_remaining;
-        size_t x_number_of_successful_allocations;
-        size_t x_number_of_successful_frees;
-    };
+    static constexpr std::size_t port_byte_alignment = Alignment;
 
-    static constexpr std::size_t port_byte_alignment = 8;
-
-    // static constexpr auto
-    // aligment_mask(auto aligment)
-    // {
-    //     if constexpr (aligment == 32) {
-    //         return 0x001f;
-    //     } else if constexpr (aligment == 16) {
-    //         return 0x000f;
-    //     } else if constexpr (aligment == 8) {
-    //         return 0x0007;
-    //     } else if constexpr (aligment == 4) {
-    //         return 0x0003;
-    //     } else if constexpr (aligment == 2) {
-    //         return 0x0001;
-    //     } else if constexpr (aligment == 1) {
-    //         return 0x0000;
-    //     } else {
-    //         static_assert("Invalid portBYTE_ALIGNMENT definition");
-    //     }
-    // }
-
-    static constexpr std::size_t port_byte_alignment_mask = 0x0007;
+    static constexpr std::size_t port_byte_alignment_mask = port_byte_alignment - 1;
+
+    static_assert(std::has_single_bit(Alignment) && (Alignment >= alignof(block_link_t)),
+                  "Alignment must be a power of two of at least the alignment of a pointer");
 
     constexpr void
     mt_coverage_test_marker()
@@ -143,6 +126,18 @@ class static_heap {
         return ((px_block->x_block_size) &= ~heap_block_allocated_bitmask);
     }
 
+    /* Size of the block that holds x_wanted_size bytes and its header, as computed by allocate(), or 0 if it
+     * does not fit a size_t. */
+    constexpr std::size_t
+    heap_block_size_for(std::size_t x_wanted_size)
+    {
+        if ((x_wanted_size == 0)
+            || (heap_add_will_overflow(x_wanted_size, x_heap_struct_size + port_byte_alignment_mask) != 0)) {
+            return 0;
+        }
+        return (x_wanted_size + x_heap_struct_size + port_byte_alignment_mask) & ~port_byte_alignment_mask;
+    }
+
     constexpr auto
     heap_protect_block_pointer(auto px_block)
     {
@@ -157,6 +152,10 @@ class static_heap {
     }
 
 public:
+    using heap_stats_t = heap_stats;
+
+    static constexpr std::size_t alignment = Alignment;
+
     void
     on_fail(callback_t callback)
     {
@@ -301,6 +300,55 @@ public:
     }
     /*-----------------------------------------------------------*/
 
+    /**
+     * Allocates a block whose address is a multiple of x_alignment, a power of two. Alignments above the heap's
+     * own take a block large enough to hold an aligned one and return the space in front of it to the free list.
+     * The block is freed with deallocate() as usual.
+     */
+    void*
+    allocate_aligned(std::size_t x_wanted_size, std::size_t x_alignment)
+    {
+        if (x_alignment <= port_byte_alignment) {
+            return allocate(x_wanted_size);
+        }
+        config_assert(std::has_single_bit(x_alignment));
+
+        /* The space in front of the aligned block must be large enough to form a free block of its own. */
+        std::size_t const x_padding = x_alignment + heap_minimum_block_size;
+        if ((x_wanted_size == 0) || (heap_add_will_overflow(x_wanted_size, x_padding) != 0)) {
+            /* Fails the way allocate() does, callback included. */
+            return allocate(0);
+        }
+
+        auto* puc = static_cast<std::uint8_t*>(allocate(x_wanted_size + x_padding));
+        if ((puc == nullptr) || (((std::size_t)puc & (x_alignment - 1)) == 0)) {
+            return puc;
+        }
+
+        std::size_t const ux_aligned_address
+            = ((std::size_t)puc + heap_minimum_block_size + x_alignment - 1) & ~(x_alignment - 1);
+        std::size_t const x_gap = ux_aligned_address - (std::size_t)puc;
+
+        auto* px_block         = reinterpret_cast<block_link_t*>(puc - x_heap_struct_size);
+        auto* px_aligned_block = reinterpret_cast<block_link_t*>(ux_aligned_address - x_heap_struct_size);
+
+        v_task_suspend_all();
+        {
+            /* The aligned block takes the rest of the allocated one, the front is freed. */
+            px_aligned_block->x_block_size = (px_block->x_block_size & ~heap_block_allocated_bitmask) - x_gap;
+            heap_allocate_block(px_aligned_block);
+            px_aligned_block->px_next_free_block = heap_protect_block_pointer(NULL);
+
+            px_block->x_block_size = x_gap;
+            x_free_bytes_remaining_ += x_gap;
+            prv_insert_block_into_free_list(px_block);
+        }
+        x_task_resume_all();
+
+        return reinterpret_cast<void*>(ux_aligned_address);
+    }
+    /*-----------------------------------------------------------*/
+
     void
     deallocate(void* pv)
     {
@@ -381,6 +429,101 @@ public:
     }
     /*-----------------------------------------------------------*/
 
+    /**
+     * Resizes the block at pv to x_new_size bytes, keeping its contents, the way realloc() does. A smaller size
+     * splits the tail off in place; a larger one takes the free block physically after it if that is large
+     * enough, and only otherwise allocates a new block, copies and frees the old one. On failure pv is left as it
+     * was and nullptr is returned. A null pv allocates, a size of 0 frees.
+     */
+    void*
+    reallocate(void* pv, std::size_t x_new_size)
+    {
+        if (pv == nullptr) {
+            return allocate(x_new_size);
+        }
+        if (x_new_size == 0) {
+            deallocate(pv);
+            return nullptr;
+        }
+
+        auto* px_link = reinterpret_cast<block_link_t*>(static_cast<std::uint8_t*>(pv) - x_heap_struct_size);
+        heap_validate_block_pointer(px_link);
+        config_assert(heap_block_is_allocated(px_link) != 0);
+
+        std::size_t const x_wanted_size = heap_block_size_for(x_new_size);
+        if ((x_wanted_size == 0) || (heap_block_size_is_valid(x_wanted_size) == 0)) {
+            /* Fails the way allocate() does, callback included. */
+            return allocate(x_new_size);
+        }
+
+        std::size_t const x_block_size = px_link->x_block_size & ~heap_block_allocated_bitmask;
+        if (x_wanted_size > x_block_size) {
+            auto* px_next = reinterpret_cast<block_link_t*>(reinterpret_cast<std::uint8_t*>(px_link) + x_block_size);
+            if ((px_next == px_end_) || (heap_block_is_allocated(px_next) != 0)
+                || (x_block_size + px_next->x_block_size < x_wanted_size)) {
+                void* pv_return = allocate(x_new_size);
+                if (pv_return != nullptr) {
+                    memcpy(pv_return, pv, x_block_size - x_heap_struct_size);
+                    deallocate(pv);
+                }
+                return pv_return;
+            }
+
+            v_task_suspend_all();
+            {
+                /* Take the following free block out of the list and append it to this one. */
+                block_link_t* px_previous_block = &x_start_;
+                while (heap_protect_block_pointer(px_previous_block->px_next_free_block) != px_next) {
+                    px_previous_block = heap_protect_block_pointer(px_previous_block->px_next_free_block);
+                }
+                px_previous_block->px_next_free_block = px_next->px_next_free_block;
+
+                x_free_bytes_remaining_ -= px_next->x_block_size;
+                px_link->x_block_size = x_block_size + px_next->x_block_size;
+                heap_allocate_block(px_link);
+            }
+            x_task_resume_all();
+        }
+
+        /* Return whatever the block holds beyond x_wanted_size to the free list, where it merges with a free
+         * block behind it. */
+        std::size_t const x_current_size = px_link->x_block_size & ~heap_block_allocated_bitmask;
+        if ((x_current_size - x_wanted_size) > heap_minimum_block_size) {
+            v_task_suspend_all();
+            {
+                auto* px_new_block_link
+                    = reinterpret_cast<block_link_t*>(reinterpret_cast<std::uint8_t*>(px_link) + x_wanted_size);
+                px_new_block_link->x_block_size = x_current_size - x_wanted_size;
+                px_link->x_block_size           = x_wanted_size;
+                heap_allocate_block(px_link);
+                x_free_bytes_remaining_ += px_new_block_link->x_block_size;
+                prv_insert_block_into_free_list(px_new_block_link);
+            }
+            x_task_resume_all();
+        }
+
+        if (x_free_bytes_remaining_ < x_minimum_ever_free_bytes_remaining_) {
+            x_minimum_ever_free_bytes_remaining_ = x_free_bytes_remaining_;
+        }
+        return pv;
+    }
+    /*-----------------------------------------------------------*/
+
+    /**
+     * Number of bytes the block at pv can hold, at least the size it was allocated with.
+     */
+    std::size_t
+    usable_size(void const* pv) const
+    {
+        if (pv == nullptr) {
+            return 0;
+        }
+        auto const* px_link
+            = reinterpret_cast<block_link_t const*>(static_cast<std::uint8_t const*>(pv) - x_heap_struct_size);
+        return (px_link->x_block_size & ~heap_block_allocated_bitmask) - x_heap_struct_size;
+    }
+    /*-----------------------------------------------------------*/
+
     static_heap()
     {
         block_link_t* px_first_free_block;
@@ -489,7 +632,7 @@ public:
 
         v_task_suspend_all();
         {
-            px_block = heapPROTECT_BLOCK_POINTER(x_start_.px_next_free_block);
+            px_block = heap_protect_block_pointer(x_start_.px_next_free_block);
 
             /* pxBlock will be NULL if the heap has not been initialised.  The heap
              * is initialised automatically when the first allocation is made. */
@@ -509,7 +652,7 @@ public:
 
                     /* Move to the next block in the chain until the last block is
                      * reached. */
-                    px_block = heapPROTECT_BLOCK_POINTER(px_block->px_next_free_block);
+                    px_block = heap_protect_block_pointer(px_block->px_next_free_block);
                 }
             }
         }
@@ -545,4 +688,9 @@ private:
     std::size_t x_number_of_successful_allocations_{};
     std::size_t x_number_of_successful_frees_{};
 };
+
+/* TLSF mode, see tlsf_heap. */
+template <std::size_t Size, std::size_t Alignment>
+class static_heap<Size, heap_mode::tlsf, Alignment> : public tlsf_heap<Size, Alignment> {};
+
 }    // namespace xitren::allocators
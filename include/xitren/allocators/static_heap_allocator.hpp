@@ -7,6 +7,8 @@ __ _(_) |_ _ _ ___ _ _
 */
 #pragma once
 
+#include <xitren/allocators/concurrent_heap.hpp>
+#include <xitren/allocators/monotonic_arena.hpp>
 #include <xitren/allocators/static_heap.hpp>
 
 #include <algorithm>
@@ -16,11 +18,12 @@ __ _(_) |_ _ _ ___ _ _
 
 namespace xitren::allocators {
 
-template <typename Type, size_t PoolSize>
+template <typename Type, size_t PoolSize, heap_mode Mode = heap_mode::first_fit,
+          class Heap = static_heap<PoolSize, Mode>>
 class static_heap_allocator {
-    static_heap<PoolSize>& manager_;
+    Heap& manager_;
 
-    template <class U, size_t FriendPoolSize>
+    template <class U, size_t FriendPoolSize, heap_mode FriendMode, class FriendHeap>
     friend class static_heap_allocator;
 
 public:
@@ -30,19 +33,25 @@ public:
     template <typename U>
     struct rebind                                            // NOLINT
     {
-        using other = static_heap_allocator<U, PoolSize>;    // NOLINT
+        using other = static_heap_allocator<U, PoolSize, Mode, Heap>;    // NOLINT
     };
 
-    constexpr explicit static_heap_allocator(static_heap<PoolSize>& manager) : manager_{manager} {}
+    constexpr explicit static_heap_allocator(Heap& manager) : manager_{manager} {}
 
     template <class U>
-    explicit static_heap_allocator(static_heap_allocator<U, PoolSize> const& other) noexcept : manager_{other.manager_}
+    explicit static_heap_allocator(static_heap_allocator<U, PoolSize, Mode, Heap> const& other) noexcept
+        : manager_{other.manager_}
     {}
 
     Type*
     allocate(size_t size)    // NOLINT
     {
-        auto ptr = static_cast<Type*>(manager_.allocate(size * sizeof(Type)));
+        Type* ptr = nullptr;
+        if constexpr (requires { manager_.allocate_aligned(size, alignof(Type)); }) {
+            ptr = static_cast<Type*>(manager_.allocate_aligned(size * sizeof(Type), alignof(Type)));
+        } else {
+            ptr = static_cast<Type*>(manager_.allocate(size * sizeof(Type)));
+        }
         if (ptr) {
             return ptr;
         }
@@ -52,22 +61,38 @@ public:
     constexpr void
     deallocate(void* ptr, [[maybe_unused]] std::size_t size = 0) noexcept    // NOLINT
     {
+        /* Heaps that cache blocks by size, like concurrent_heap, get it back. */
+        if constexpr (requires { manager_.deallocate(ptr, size); }) {
+            if (size != 0) {
+                manager_.deallocate(ptr, size * sizeof(Type));
+                return;
+            }
+        }
         manager_.deallocate(ptr);
     }
 
     template <typename U>
     constexpr bool
-    operator==(static_heap_allocator<U, PoolSize> const& other) noexcept
+    operator==(static_heap_allocator<U, PoolSize, Mode, Heap> const& other) noexcept
     {
         return this == &other;
     }
 
     template <typename U>
     constexpr bool
-    operator!=(static_heap_allocator<U, PoolSize> const& other) noexcept
+    operator!=(static_heap_allocator<U, PoolSize, Mode, Heap> const& other) noexcept
     {
         return !this->operator==(other);
     }
 };
 
+/* Allocator over a thread-safe concurrent_heap. */
+template <typename Type, size_t PoolSize, heap_mode Mode = heap_mode::first_fit>
+using concurrent_heap_allocator = static_heap_allocator<Type, PoolSize, Mode, concurrent_heap<PoolSize, Mode>>;
+
+/* Allocator over a monotonic_arena: freeing is a no-op until the arena is reset. */
+template <typename Type, size_t PoolSize, class Upstream = void>
+using monotonic_arena_allocator
+    = static_heap_allocator<Type, PoolSize, heap_mode::first_fit, monotonic_arena<PoolSize, Upstream>>;
+
 }    // namespace xitren::allocators
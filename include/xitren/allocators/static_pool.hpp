@@ -0,0 +1,158 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace xitren::allocators {
+
+/**
+ * @brief Slab of N equal slots for objects of type T, allocated and freed by popping and pushing an intrusive
+ * free list.
+ *
+ * A free slot holds the link to the next free one, so slots carry no header and the pool never fragments: any
+ * freed slot fits the next allocation. Slots that were never used are handed out in address order before the free
+ * list is consulted, which keeps construction trivial and leaves untouched pages of a large pool unmapped.
+ *
+ * Without a Heap the slots are a member array, so the pool can live in static storage. Given a Heap with the
+ * static_heap interface, the pool carves its N slots out of that heap in one block when it is constructed and
+ * returns the block when it is destroyed.
+ *
+ * allocate() returns raw storage; constructing and destroying the object is up to the caller. Like static_heap the
+ * pool is not synchronized, so it must not be shared between threads without a lock.
+ */
+template <class T, std::size_t N, class Heap = void>
+class static_pool {
+    union slot {
+        slot* next;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    static constexpr bool has_heap = !std::is_void_v<Heap>;
+
+    using heap_pointer = std::conditional_t<has_heap, Heap*, std::nullptr_t>;
+    using slots_type   = std::conditional_t<has_heap, slot*, slot[N]>;
+
+public:
+    static constexpr std::size_t slot_size = sizeof(slot);
+
+    constexpr static_pool() noexcept
+        requires(!has_heap)
+    = default;
+
+    /**
+     * Takes the slots from heap.
+     *
+     * @throws std::bad_alloc if the heap has no free block of N slots.
+     */
+    template <class H = Heap>
+        requires has_heap
+    explicit static_pool(H& heap) : heap_{&heap}, slots_{static_cast<slot*>(take(heap))}
+    {
+        if (slots_ == nullptr) {
+            throw std::bad_alloc();
+        }
+    }
+
+    ~static_pool()
+        requires(!has_heap)
+    = default;
+
+    ~static_pool()
+        requires has_heap
+    {
+        heap_->deallocate(slots_);
+    }
+
+    static_pool(static_pool const&) = delete;
+    static_pool&
+    operator=(static_pool const&)
+        = delete;
+
+    /**
+     * @return storage for one T, or nullptr when all N slots are taken.
+     */
+    T*
+    allocate() noexcept
+    {
+        slot* taken = free_list_;
+        if (taken != nullptr) {
+            free_list_ = taken->next;
+        } else if (untouched_ < N) {
+            taken = &slots_[untouched_++];
+        } else {
+            return nullptr;
+        }
+        used_++;
+        return reinterpret_cast<T*>(taken->storage);
+    }
+
+    /**
+     * Returns a slot of this pool; nullptr and pointers from elsewhere are ignored.
+     */
+    void
+    deallocate(T* pointer) noexcept
+    {
+        if (!owns(pointer)) {
+            return;
+        }
+        auto* freed = reinterpret_cast<slot*>(pointer);
+        freed->next = free_list_;
+        free_list_  = freed;
+        used_--;
+    }
+
+    bool
+    owns(void const* pointer) const noexcept
+    {
+        auto const address = reinterpret_cast<std::uintptr_t>(pointer);
+        auto const first   = reinterpret_cast<std::uintptr_t>(&slots_[0]);
+        return (address >= first) && (address < first + N * slot_size) && (((address - first) % slot_size) == 0);
+    }
+
+    static constexpr std::size_t
+    capacity() noexcept
+    {
+        return N;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return used_;
+    }
+
+    std::size_t
+    free_slots() const noexcept
+    {
+        return N - used_;
+    }
+
+private:
+    [[no_unique_address]] heap_pointer heap_{};
+    slots_type                         slots_;
+    slot*                              free_list_{nullptr};
+    std::size_t                        untouched_{};
+    std::size_t                        used_{};
+
+    template <class H>
+    static void*
+    take(H& heap)
+    {
+        if constexpr (requires { heap.allocate_aligned(N * slot_size, alignof(slot)); }) {
+            return heap.allocate_aligned(N * slot_size, alignof(slot));
+        } else {
+            return heap.allocate(N * slot_size);
+        }
+    }
+};
+
+}    // namespace xitren::allocators
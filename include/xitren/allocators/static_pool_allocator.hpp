@@ -0,0 +1,203 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <xitren/allocators/static_pool.hpp>
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace xitren::allocators {
+
+/**
+ * @brief Pools of N slots for up to Classes different object sizes, all carved from one caller-supplied heap.
+ *
+ * The pool for a size is created the first time an object of that size and alignment is requested, so containers
+ * need not know their node types in advance. Objects of the same size and alignment share a pool. The pools return
+ * their slots to the heap when the set is destroyed, which must happen after every object is freed.
+ *
+ * The set is not synchronized: every container that uses it must be used by one thread at a time.
+ */
+template <std::size_t N, class Heap, std::size_t Classes = 4>
+class static_pool_set {
+    template <std::size_t SlotSize, std::size_t SlotAlignment>
+    struct alignas(SlotAlignment) slot_storage {
+        std::byte bytes[SlotSize];
+    };
+
+public:
+    /* Raw slot of the size and alignment of T. */
+    template <class T>
+    using slot_type = slot_storage<sizeof(T), alignof(T)>;
+
+    template <class T>
+    using pool_type = static_pool<slot_type<T>, N, Heap>;
+
+    explicit static_pool_set(Heap& heap) noexcept : heap_{heap} {}
+
+    ~static_pool_set()
+    {
+        for (auto& entry : classes_) {
+            if (entry.destroy != nullptr) {
+                entry.destroy(entry.storage.data());
+            }
+        }
+    }
+
+    static_pool_set(static_pool_set const&) = delete;
+    static_pool_set&
+    operator=(static_pool_set const&)
+        = delete;
+
+    /**
+     * The pool for objects of type T, created on first use.
+     *
+     * @throws std::bad_alloc if all Classes pools hold other sizes or the heap cannot hold N more slots.
+     */
+    template <class T>
+    pool_type<T>&
+    pool()
+    {
+        if (auto* existing = find<T>(); existing != nullptr) {
+            return *existing;
+        }
+        static_assert((sizeof(pool_type<T>) == sizeof(any_pool)) && (alignof(pool_type<T>) <= alignof(any_pool)));
+        for (auto& entry : classes_) {
+            if (entry.destroy == nullptr) {
+                auto* created = ::new (entry.storage.data()) pool_type<T>{heap_};
+                entry.size    = sizeof(T);
+                entry.align   = alignof(T);
+                entry.destroy = [](std::byte* storage) {
+                    std::launder(reinterpret_cast<pool_type<T>*>(storage))->~pool_type<T>();
+                };
+                return *created;
+            }
+        }
+        throw std::bad_alloc();
+    }
+
+    /**
+     * @return the pool for objects of type T, or nullptr if none was created yet.
+     */
+    template <class T>
+    pool_type<T>*
+    find() noexcept
+    {
+        for (auto& entry : classes_) {
+            if ((entry.destroy != nullptr) && (entry.size == sizeof(T)) && (entry.align == alignof(T))) {
+                return std::launder(reinterpret_cast<pool_type<T>*>(entry.storage.data()));
+            }
+        }
+        return nullptr;
+    }
+
+    Heap&
+    heap() const noexcept
+    {
+        return heap_;
+    }
+
+private:
+    /* Every pool_type has the same layout whatever its slot size, so one buffer fits any of them. */
+    using any_pool = static_pool<std::max_align_t, N, Heap>;
+
+    struct pool_class {
+        alignas(any_pool) std::array<std::byte, sizeof(any_pool)> storage{};
+        std::size_t                                                size{};
+        std::size_t                                                align{};
+        void (*destroy)(std::byte*){nullptr};
+    };
+
+    Heap&                           heap_;
+    std::array<pool_class, Classes> classes_{};
+};
+
+/**
+ * @brief Standard allocator for node-based containers (std::list, std::forward_list, std::set, std::map and their
+ * multi variants) that takes every node from a static_pool_set.
+ *
+ * A container rebinds its allocator to its internal node type, whose size is unknown to the caller, so the
+ * allocator refers to a whole static_pool_set and takes the pool for the node type from it. Allocators compare
+ * equal when they use the same set. Containers that should not share slots, or that run on different threads,
+ * get sets of their own.
+ *
+ * Only single objects come from the pools. Array allocations, such as the bucket array of std::unordered_map, and
+ * an exhausted pool throw std::bad_alloc.
+ */
+template <typename Type, std::size_t N, class Heap, std::size_t Classes = 4>
+class static_pool_allocator {
+    using pool_set = static_pool_set<N, Heap, Classes>;
+
+    pool_set* pools_;
+
+    template <class U, std::size_t FriendN, class FriendHeap, std::size_t FriendClasses>
+    friend class static_pool_allocator;
+
+public:
+    using value_type      = Type;               // NOLINT
+    using is_always_equal = std::false_type;    // NOLINT
+
+    template <typename U>
+    struct rebind                                                // NOLINT
+    {
+        using other = static_pool_allocator<U, N, Heap, Classes>;    // NOLINT
+    };
+
+    constexpr explicit static_pool_allocator(pool_set& pools) noexcept : pools_{&pools} {}
+
+    template <class U>
+    constexpr explicit static_pool_allocator(static_pool_allocator<U, N, Heap, Classes> const& other) noexcept
+        : pools_{other.pools_}
+    {}
+
+    Type*
+    allocate(std::size_t size)    // NOLINT
+    {
+        if (size == 1) {
+            if (auto* ptr = pools_->template pool<Type>().allocate(); ptr) {
+                return reinterpret_cast<Type*>(ptr);
+            }
+        }
+        throw std::bad_alloc();
+    }
+
+    void
+    deallocate(Type* ptr, [[maybe_unused]] std::size_t size = 1) noexcept    // NOLINT
+    {
+        if (auto* pool = pools_->template find<Type>(); pool != nullptr) {
+            pool->deallocate(reinterpret_cast<typename pool_set::template slot_type<Type>*>(ptr));
+        }
+    }
+
+    /**
+     * The pools that hold the objects of this allocator.
+     */
+    pool_set&
+    pools() const noexcept
+    {
+        return *pools_;
+    }
+
+    template <typename U>
+    constexpr bool
+    operator==(static_pool_allocator<U, N, Heap, Classes> const& other) const noexcept
+    {
+        return pools_ == other.pools_;
+    }
+
+    template <typename U>
+    constexpr bool
+    operator!=(static_pool_allocator<U, N, Heap, Classes> const& other) const noexcept
+    {
+        return !(*this == other);
+    }
+};
+
+}    // namespace xitren::allocators
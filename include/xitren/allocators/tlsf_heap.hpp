@@ -0,0 +1,472 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/allocators/heap_stats.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace xitren::allocators {
+
+/**
+ * @brief Two-level segregated fit (TLSF) heap over a fixed buffer: allocate and deallocate take bounded, O(1)
+ * time however many blocks there are.
+ *
+ * Free blocks are kept in size classes: the first level splits sizes by powers of two, the second level splits
+ * every power of two into 32 linear ranges. Two bitmaps record which classes have free blocks, so finding a block
+ * that fits is a couple of count-trailing-zeros instructions instead of a walk over the free list. Every block
+ * carries the flags of itself and of its physical predecessor, and a free block also a pointer to that
+ * predecessor, so a freed block is merged with both neighbours without searching either.
+ *
+ * Allocated blocks have a header of one size_t; the interface and statistics are those of static_heap, which
+ * uses this class for heap_mode::tlsf. Blocks are laid out on an 8 byte grid; a larger Alignment makes allocate()
+ * go through allocate_aligned().
+ */
+template <std::size_t Size, std::size_t Alignment = 8>
+class tlsf_heap {
+    using callback_t = std::function<void(void)>;
+
+    /* The physical predecessor link lies in the last word of the previous block, and is only valid while that
+     * block is free; the free list links lie in the payload of a free block. */
+    struct block_header {
+        block_header* prev_physical;
+        std::size_t   size;
+        block_header* next_free;
+        block_header* prev_free;
+    };
+
+    static constexpr std::size_t granularity      = 8;
+    static constexpr std::size_t sl_index_log2    = 5;
+    static constexpr std::size_t sl_index_count   = std::size_t{1} << sl_index_log2;
+    static constexpr std::size_t fl_index_shift   = sl_index_log2 + std::countr_zero(granularity);
+    static constexpr std::size_t small_block_size = std::size_t{1} << fl_index_shift;
+    static constexpr std::size_t size_bits        = static_cast<std::size_t>(std::bit_width(Size));
+    static constexpr std::size_t fl_index_count   = (size_bits > fl_index_shift) ? size_bits - fl_index_shift + 1 : 1;
+
+    static constexpr std::size_t header_overhead = sizeof(std::size_t);
+    static constexpr std::size_t payload_offset  = offsetof(block_header, size) + sizeof(std::size_t);
+    static constexpr std::size_t min_block_size  = sizeof(block_header) - sizeof(block_header*);
+    static constexpr std::size_t free_bit        = 1;
+    static constexpr std::size_t prev_free_bit   = 2;
+    static constexpr std::size_t flag_mask       = free_bit | prev_free_bit;
+
+    static_assert(Size >= 4 * sizeof(block_header), "Heap is too small to hold a single block");
+    static_assert(std::has_single_bit(Alignment) && (Alignment >= granularity), "Alignment must be a power of two");
+    static_assert(fl_index_count < std::numeric_limits<std::uint64_t>::digits, "Heap is too large");
+
+    using free_lists = std::array<std::array<block_header*, sl_index_count>, fl_index_count>;
+
+public:
+    using heap_stats_t = heap_stats;
+
+    static constexpr std::size_t alignment = Alignment;
+
+    tlsf_heap()
+    {
+        auto const start = align_up(reinterpret_cast<std::size_t>(heap_));
+        auto const end   = reinterpret_cast<std::size_t>(heap_) + Size;
+
+        /* One free block spans the heap and is followed by an empty sentinel block that is never free, so the
+         * last real block always has a physical successor. */
+        auto* first = reinterpret_cast<block_header*>(start);
+        first->size = ((end - start - payload_offset - header_overhead) & ~(granularity - 1)) | free_bit;
+        auto* last  = link_next(first);
+        last->size  = prev_free_bit;
+        insert_free(first);
+
+        free_bytes_remaining_              = block_size(first) + header_overhead;
+        minimum_ever_free_bytes_remaining_ = free_bytes_remaining_;
+    }
+
+    tlsf_heap(tlsf_heap const&) = delete;
+    tlsf_heap&
+    operator=(tlsf_heap const&)
+        = delete;
+
+    void
+    on_fail(callback_t callback)
+    {
+        callback_ = callback;
+    }
+
+    void*
+    allocate(std::size_t wanted_size)
+    {
+        return allocate_aligned(wanted_size, Alignment);
+    }
+
+    /**
+     * Allocates a block whose address is a multiple of align, a power of two. For alignments above 8 the block is
+     * taken with room for an aligned one, and the space in front of it is split off as a free block.
+     */
+    void*
+    allocate_aligned(std::size_t wanted_size, std::size_t align)
+    {
+        void* result = nullptr;
+        if ((wanted_size > 0) && (wanted_size <= Size) && (align <= Size)) {
+            auto const size    = std::max(align_up(wanted_size), min_block_size);
+            auto const padding = (align > granularity) ? align + sizeof(block_header) : 0;
+            if (auto* block = find_free(size + padding); block != nullptr) {
+                remove_free(block);
+                if (padding != 0) {
+                    block = align_block(block, align);
+                }
+                split(block, size);
+                mark_used(block);
+                free_bytes_remaining_ -= block_size(block) + header_overhead;
+                minimum_ever_free_bytes_remaining_
+                    = std::min(minimum_ever_free_bytes_remaining_, free_bytes_remaining_);
+                number_of_successful_allocations_++;
+                result = to_pointer(block);
+            }
+        }
+        if ((result == nullptr) && (callback_ != nullptr)) {
+            callback_();
+        }
+        return result;
+    }
+
+    void
+    deallocate(void* pointer)
+    {
+        if (pointer == nullptr) {
+            return;
+        }
+        /* Pointers from elsewhere and blocks that are already free are ignored, as in heap_mode::first_fit. */
+        auto* const address = static_cast<std::uint8_t*>(pointer);
+        if ((address < heap_ + payload_offset) || (address >= heap_ + Size)) {
+            return;
+        }
+        auto* block = from_pointer(pointer);
+        if (is_free(block)) {
+            return;
+        }
+        free_bytes_remaining_ += block_size(block) + header_overhead;
+        number_of_successful_frees_++;
+
+        if ((block->size & prev_free_bit) != 0) {
+            auto* previous = block->prev_physical;
+            remove_free(previous);
+            set_size(previous, block_size(previous) + block_size(block) + header_overhead);
+            block = previous;
+        }
+        if (auto* next = next_physical(block); is_free(next)) {
+            remove_free(next);
+            set_size(block, block_size(block) + block_size(next) + header_overhead);
+        }
+        mark_free(block);
+        insert_free(block);
+    }
+
+    void*
+    callocate(std::size_t num, std::size_t size)
+    {
+        if ((size != 0) && (num > std::numeric_limits<std::size_t>::max() / size)) {
+            return nullptr;
+        }
+        void* result = allocate(num * size);
+        if (result != nullptr) {
+            std::memset(result, 0, num * size);
+        }
+        return result;
+    }
+
+    /**
+     * Resizes the block at pointer as static_heap::reallocate() does: in place if the block, together with a free
+     * block physically after it, is large enough, and otherwise by allocating, copying and freeing.
+     */
+    void*
+    reallocate(void* pointer, std::size_t new_size)
+    {
+        if (pointer == nullptr) {
+            return allocate(new_size);
+        }
+        if (new_size == 0) {
+            deallocate(pointer);
+            return nullptr;
+        }
+        if (new_size > Size) {
+            return allocate(new_size);
+        }
+
+        auto*      block    = from_pointer(pointer);
+        auto const old_size = block_size(block);
+        auto const size     = std::max(align_up(new_size), min_block_size);
+        auto*      next     = next_physical(block);
+        if ((size > old_size) && (!is_free(next) || (old_size + block_size(next) + header_overhead < size))) {
+            void* result = allocate(new_size);
+            if (result != nullptr) {
+                std::memcpy(result, pointer, old_size);
+                deallocate(pointer);
+            }
+            return result;
+        }
+
+        /* Absorb a free successor, then split off whatever is not needed, which merges into one free block. */
+        if (is_free(next)) {
+            remove_free(next);
+            set_size(block, block_size(block) + block_size(next) + header_overhead);
+            next_physical(block)->size &= ~prev_free_bit;
+        }
+        split(block, size);
+        free_bytes_remaining_ = free_bytes_remaining_ + old_size - block_size(block);
+        minimum_ever_free_bytes_remaining_ = std::min(minimum_ever_free_bytes_remaining_, free_bytes_remaining_);
+        return pointer;
+    }
+
+    /**
+     * Number of bytes the block at pointer can hold, at least the size it was allocated with.
+     */
+    std::size_t
+    usable_size(void const* pointer) const
+    {
+        if (pointer == nullptr) {
+            return 0;
+        }
+        return block_size(
+            reinterpret_cast<block_header const*>(static_cast<std::uint8_t const*>(pointer) - payload_offset));
+    }
+
+    std::size_t
+    free_heap_size() const
+    {
+        return free_bytes_remaining_;
+    }
+
+    std::size_t
+    minimum_ever_free_heap_size() const
+    {
+        return minimum_ever_free_bytes_remaining_;
+    }
+
+    void
+    reset_minimum_ever_free_heap_size()
+    {
+        minimum_ever_free_bytes_remaining_ = free_bytes_remaining_;
+    }
+
+    void
+    v_port_get_heap_stats(heap_stats_t* stats) const
+    {
+        std::size_t blocks{}, max_size{}, min_size{};
+        for (auto first_level = fl_bitmap_; first_level != 0; first_level &= first_level - 1) {
+            auto const fl = static_cast<std::size_t>(std::countr_zero(first_level));
+            for (auto const* block : free_lists_[fl]) {
+                for (; block != nullptr; block = block->next_free) {
+                    auto const size = block_size(block) + header_overhead;
+                    max_size        = std::max(max_size, size);
+                    min_size        = (blocks == 0) ? size : std::min(min_size, size);
+                    blocks++;
+                }
+            }
+        }
+        stats->x_available_heap_space_in_bytes        = free_bytes_remaining_;
+        stats->x_size_of_largest_free_block_in_bytes  = max_size;
+        stats->x_size_of_smallest_free_block_in_bytes = min_size;
+        stats->x_number_of_free_blocks                = blocks;
+        stats->x_minimum_ever_free_bytes_remaining    = minimum_ever_free_bytes_remaining_;
+        stats->x_number_of_successful_allocations     = number_of_successful_allocations_;
+        stats->x_number_of_successful_frees           = number_of_successful_frees_;
+    }
+
+private:
+    callback_t   callback_{nullptr};
+    std::uint8_t heap_[Size]{};
+
+    std::uint64_t                             fl_bitmap_{};
+    std::array<std::uint32_t, fl_index_count> sl_bitmap_{};
+    free_lists                                free_lists_{};
+
+    std::size_t free_bytes_remaining_{};
+    std::size_t minimum_ever_free_bytes_remaining_{};
+    std::size_t number_of_successful_allocations_{};
+    std::size_t number_of_successful_frees_{};
+
+    static constexpr std::size_t
+    align_up(std::size_t value)
+    {
+        return (value + granularity - 1) & ~(granularity - 1);
+    }
+
+    static std::size_t
+    block_size(block_header const* block)
+    {
+        return block->size & ~flag_mask;
+    }
+
+    static void
+    set_size(block_header* block, std::size_t size)
+    {
+        block->size = size | (block->size & flag_mask);
+    }
+
+    static bool
+    is_free(block_header const* block)
+    {
+        return (block->size & free_bit) != 0;
+    }
+
+    static void*
+    to_pointer(block_header* block)
+    {
+        return reinterpret_cast<std::uint8_t*>(block) + payload_offset;
+    }
+
+    static block_header*
+    from_pointer(void* pointer)
+    {
+        return reinterpret_cast<block_header*>(static_cast<std::uint8_t*>(pointer) - payload_offset);
+    }
+
+    static block_header*
+    next_physical(block_header* block)
+    {
+        return reinterpret_cast<block_header*>(static_cast<std::uint8_t*>(to_pointer(block)) + block_size(block)
+                                               - header_overhead);
+    }
+
+    static block_header*
+    link_next(block_header* block)
+    {
+        auto* next          = next_physical(block);
+        next->prev_physical = block;
+        return next;
+    }
+
+    static void
+    mark_free(block_header* block)
+    {
+        link_next(block)->size |= prev_free_bit;
+        block->size |= free_bit;
+    }
+
+    static void
+    mark_used(block_header* block)
+    {
+        next_physical(block)->size &= ~prev_free_bit;
+        block->size &= ~free_bit;
+    }
+
+    /* First and second level index of the class that holds blocks of the given size. */
+    static std::pair<std::size_t, std::size_t>
+    mapping(std::size_t size)
+    {
+        if (size < small_block_size) {
+            return {0, size / (small_block_size / sl_index_count)};
+        }
+        auto const fl = static_cast<std::size_t>(std::bit_width(size)) - 1;
+        return {fl - fl_index_shift + 1, (size >> (fl - sl_index_log2)) ^ sl_index_count};
+    }
+
+    /* Any block of the first class that is not smaller than this size's own class fits it without a search. */
+    static std::pair<std::size_t, std::size_t>
+    search_mapping(std::size_t size)
+    {
+        if (size >= small_block_size) {
+            size += (std::size_t{1} << (static_cast<std::size_t>(std::bit_width(size)) - 1 - sl_index_log2)) - 1;
+        }
+        return mapping(size);
+    }
+
+    block_header*
+    find_free(std::size_t size) const
+    {
+        auto [fl, sl] = search_mapping(size);
+        if (fl >= fl_index_count) {
+            return nullptr;
+        }
+        auto second_level = sl_bitmap_[fl] & (~std::uint32_t{0} << sl);
+        if (second_level == 0) {
+            auto const first_level = fl_bitmap_ & (~std::uint64_t{0} << (fl + 1));
+            if (first_level == 0) {
+                return nullptr;
+            }
+            fl           = static_cast<std::size_t>(std::countr_zero(first_level));
+            second_level = sl_bitmap_[fl];
+        }
+        return free_lists_[fl][static_cast<std::size_t>(std::countr_zero(second_level))];
+    }
+
+    void
+    insert_free(block_header* block)
+    {
+        auto const [fl, sl] = mapping(block_size(block));
+        auto*& head         = free_lists_[fl][sl];
+        block->next_free    = head;
+        block->prev_free    = nullptr;
+        if (head != nullptr) {
+            head->prev_free = block;
+        }
+        head = block;
+        fl_bitmap_ |= std::uint64_t{1} << fl;
+        sl_bitmap_[fl] |= std::uint32_t{1} << sl;
+    }
+
+    void
+    remove_free(block_header* block)
+    {
+        auto const [fl, sl] = mapping(block_size(block));
+        if (block->next_free != nullptr) {
+            block->next_free->prev_free = block->prev_free;
+        }
+        if (block->prev_free != nullptr) {
+            block->prev_free->next_free = block->next_free;
+            return;
+        }
+        free_lists_[fl][sl] = block->next_free;
+        if (block->next_free == nullptr) {
+            sl_bitmap_[fl] &= ~(std::uint32_t{1} << sl);
+            if (sl_bitmap_[fl] == 0) {
+                fl_bitmap_ &= ~(std::uint64_t{1} << fl);
+            }
+        }
+    }
+
+    /* Splits the front off a block taken off the free lists, as a free block of at least sizeof(block_header)
+     * bytes, so the payload of the rest is aligned to align. Returns the rest. */
+    block_header*
+    align_block(block_header* block, std::size_t align)
+    {
+        auto const payload = reinterpret_cast<std::size_t>(to_pointer(block));
+        if ((payload & (align - 1)) == 0) {
+            return block;
+        }
+        auto const aligned = (payload + sizeof(block_header) + align - 1) & ~(align - 1);
+        auto const gap     = aligned - payload;
+        auto*      rest    = from_pointer(reinterpret_cast<void*>(aligned));
+        rest->size         = (block_size(block) - gap) | free_bit;
+        set_size(block, gap - header_overhead);
+        mark_free(block);
+        insert_free(block);
+        return rest;
+    }
+
+    /* Cuts the tail of a block taken off the free lists into a new free block, if it is large enough for one. */
+    void
+    split(block_header* block, std::size_t size)
+    {
+        if (block_size(block) < size + sizeof(block_header)) {
+            return;
+        }
+        auto* rest = reinterpret_cast<block_header*>(static_cast<std::uint8_t*>(to_pointer(block)) + size
+                                                     - header_overhead);
+        rest->size = block_size(block) - size - header_overhead;
+        set_size(block, size);
+        mark_free(rest);
+        insert_free(rest);
+    }
+};
+
+}    // namespace xitren::allocators
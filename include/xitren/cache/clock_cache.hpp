@@ -0,0 +1,296 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/exceptions.hpp>
+#include <xitren/cache/index_table.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace xitren::cache {
+
+/**
+ * @brief Thread-safe cache with the lru interface, evicting by the CLOCK (second chance) approximation of LRU.
+ *
+ * A hit does not reorder anything, it only sets the reference bit of the slot with a relaxed atomic store. On
+ * eviction the hand sweeps the slots, clearing reference bits, and replaces the first slot that was not referenced
+ * since the previous sweep (or has expired).
+ *
+ * When Key and Value are trivially copyable, get and touch take no lock and write no shared state: they copy the
+ * entry with relaxed atomic loads and check a version counter that put makes odd while it changes the cache,
+ * retrying if a put ran meanwhile, so readers never contend with each other. A reader that keeps losing to puts
+ * falls back to the lock in shared mode. Other types are always read under the shared lock, so readers still
+ * share its lock word. put takes the lock exclusively.
+ *
+ * Expired entries found by get are reported as missed, but stay in place until the hand reclaims them.
+ */
+template <std::default_initializable Key, std::default_initializable Value, std::size_t Size, bool Exception = true>
+class clock_cache {
+    using clock_type  = std::chrono::steady_clock;
+    using timestamp   = std::chrono::time_point<clock_type>;
+    using period_type = clock_type::duration;
+    using data_item   = std::tuple<Key, Value, timestamp>;
+    using return_type = std::optional<data_item>;
+
+    static constexpr bool optimistic_reads
+        = std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>;
+    static constexpr int optimistic_attempts = 4;
+
+    using table_type = index_table<Key, Size, optimistic_reads>;
+    using index_type = typename table_type::index_type;
+
+    static constexpr index_type npos = table_type::npos;
+
+    struct slot_type {
+        Key               key{};
+        Value             value{};
+        timestamp         time{};
+        std::atomic<bool> referenced{false};
+    };
+
+    /* Keeps the version odd while put changes the table and the slots, so optimistic readers retry. */
+    class write_scope {
+    public:
+        explicit write_scope(std::atomic<std::uint64_t>& version) noexcept : version_{version}
+        {
+            if constexpr (optimistic_reads) {
+                version_.store(version_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+        }
+
+        ~write_scope()
+        {
+            if constexpr (optimistic_reads) {
+                version_.store(version_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+        }
+
+        write_scope(write_scope const&) = delete;
+        write_scope&
+        operator=(write_scope const&)
+            = delete;
+
+    private:
+        std::atomic<std::uint64_t>& version_;
+    };
+
+public:
+    explicit clock_cache(period_type expired) noexcept : expired_after_{expired} {}
+
+    void
+    put(Key key, Value value)
+    {
+        std::unique_lock<std::shared_mutex> lock(access_);
+        write_scope                         scope{version_};
+        auto const                          now = get_time();
+        if (auto const pos = table_.find(key, key_of()); pos != npos) {
+            auto& slot = slots_[table_[pos]];
+            store(slot.value, std::move(value));
+            store(slot.time, now);
+            slot.referenced.store(true, std::memory_order_relaxed);
+            return;
+        }
+        index_type idx;
+        if (size_ < Size) {
+            idx = static_cast<index_type>(size_++);
+        } else {
+            idx = evict(now);
+        }
+        auto& slot = slots_[idx];
+        store(slot.key, std::move(key));
+        store(slot.value, std::move(value));
+        store(slot.time, now);
+        slot.referenced.store(false, std::memory_order_relaxed);
+        table_.insert(slot.key, idx);
+    }
+
+    return_type
+    get(Key key)
+    {
+        auto item = read(key, [this](index_type idx) {
+            auto const& slot = slots_[idx];
+            return std::pair{idx, data_item{load(slot.key), load(slot.value), load(slot.time)}};
+        });
+        if (!item) {
+            return std::nullopt;
+        }
+        if ((get_time() - std::get<2>(item->second)) >= expired_after_) {
+            if constexpr (Exception) {
+                throw cache_timeout();
+            }
+            return std::nullopt;
+        }
+        mark(slots_[item->first]);
+        return std::move(item->second);
+    }
+
+    /**
+     * Marks the key as recently used without copying its value.
+     *
+     * @return true if the key is present in the cache.
+     */
+    bool
+    touch(Key const& key)
+    {
+        auto const idx = read(key, [](index_type found) { return found; });
+        if (!idx) {
+            return false;
+        }
+        mark(slots_[*idx]);
+        return true;
+    }
+
+    std::size_t
+    size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(access_);
+        return size_;
+    }
+
+    auto
+    expired_after() const
+    {
+        return expired_after_;
+    }
+
+private:
+    const period_type           expired_after_;
+    std::array<slot_type, Size> slots_{};
+    table_type                  table_{};
+    std::size_t                 hand_{};
+    std::size_t                 size_{};
+    std::atomic<std::uint64_t>  version_{};
+    mutable std::shared_mutex   access_{};
+
+    inline timestamp
+    get_time()
+    {
+        return clock_type::now();
+    }
+
+    /**
+     * Finds the key and returns read_slot(index) of its slot. Optimistic lookups run without the lock and are
+     * only returned if the version did not change meanwhile; after optimistic_attempts failed ones, and for other
+     * types, the lookup holds the lock in shared mode.
+     */
+    template <class ReadSlot>
+    auto
+    read(Key const& key, ReadSlot&& read_slot) const -> std::optional<std::invoke_result_t<ReadSlot&, index_type>>
+    {
+        using result_type = std::optional<std::invoke_result_t<ReadSlot&, index_type>>;
+
+        if constexpr (optimistic_reads) {
+            for (int attempt{}; attempt < optimistic_attempts; attempt++) {
+                auto const before = version_.load(std::memory_order_acquire);
+                if ((before & 1) != 0) {
+                    continue;
+                }
+                auto const  pos = table_.find(key, key_of());
+                auto const  idx = (pos == npos) ? npos : table_[pos];
+                result_type result{};
+                if (idx < Size) {
+                    result = read_slot(idx);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (version_.load(std::memory_order_relaxed) == before) {
+                    return result;
+                }
+            }
+        }
+        std::shared_lock<std::shared_mutex> lock(access_);
+        auto const                          pos = table_.find(key, key_of());
+        if (pos == npos) {
+            return std::nullopt;
+        }
+        return read_slot(table_[pos]);
+    }
+
+    /* Whole-object atomic accesses are used where they need no lock and no extra alignment, bytes otherwise. */
+    template <class Type>
+    static constexpr bool whole_object
+        = std::atomic_ref<Type>::is_always_lock_free && (std::atomic_ref<Type>::required_alignment <= alignof(Type));
+
+    /* Copies a field that put may be writing at the same time; the version tells whether the copy is valid. */
+    template <class Type>
+    static decltype(auto)
+    load(Type const& source) noexcept
+    {
+        if constexpr (!optimistic_reads) {
+            return (source);
+        } else if constexpr (whole_object<Type>) {
+            return std::atomic_ref<Type>{const_cast<Type&>(source)}.load(std::memory_order_relaxed);
+        } else {
+            std::array<unsigned char, sizeof(Type)> bytes;
+            auto* from = reinterpret_cast<unsigned char*>(const_cast<Type*>(&source));
+            for (std::size_t i{}; i < sizeof(Type); i++) {
+                bytes[i] = std::atomic_ref<unsigned char>{from[i]}.load(std::memory_order_relaxed);
+            }
+            return std::bit_cast<Type>(bytes);
+        }
+    }
+
+    template <class Type>
+    static void
+    store(Type& target, Type value) noexcept(std::is_nothrow_move_assignable_v<Type>)
+    {
+        if constexpr (!optimistic_reads) {
+            target = std::move(value);
+        } else if constexpr (whole_object<Type>) {
+            std::atomic_ref<Type>{target}.store(value, std::memory_order_relaxed);
+        } else {
+            auto const bytes = std::bit_cast<std::array<unsigned char, sizeof(Type)>>(value);
+            auto*      to    = reinterpret_cast<unsigned char*>(&target);
+            for (std::size_t i{}; i < sizeof(Type); i++) {
+                std::atomic_ref<unsigned char>{to[i]}.store(bytes[i], std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static void
+    mark(slot_type& slot) noexcept
+    {
+        /* Check first, so hot entries do not keep invalidating the cache line in other cores. */
+        if (!slot.referenced.load(std::memory_order_relaxed)) {
+            slot.referenced.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    index_type
+    evict(timestamp now) noexcept
+    {
+        for (;;) {
+            auto& slot = slots_[hand_];
+            auto  idx  = static_cast<index_type>(hand_);
+            hand_      = (hand_ + 1) % Size;
+            if (!slot.referenced.exchange(false, std::memory_order_relaxed)
+                || ((now - slot.time) >= expired_after_)) {
+                table_.erase(table_.find(slot.key, key_of()), key_of());
+                return idx;
+            }
+        }
+    }
+
+    auto
+    key_of() const noexcept
+    {
+        return [this](index_type idx) -> decltype(auto) { return load(slots_[idx].key); };
+    }
+};
+
+}    // namespace xitren::cache
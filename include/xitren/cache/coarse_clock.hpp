@@ -0,0 +1,84 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/func/interval_event.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace xitren::cache {
+
+/**
+ * @brief Monotonic clock that reads a cached time point instead of querying the system.
+ *
+ * While at least one ticker is alive, now() is a single relaxed atomic load of a value the ticker refreshes from
+ * std::chrono::steady_clock every resolution period. Without a ticker it falls back to steady_clock::now(), so
+ * it can be used as the Clock of a cache in any case.
+ */
+class coarse_clock {
+    using base_clock = std::chrono::steady_clock;
+
+public:
+    using rep                       = base_clock::rep;
+    using period                    = base_clock::period;
+    using duration                  = base_clock::duration;
+    using time_point                = base_clock::time_point;
+    static constexpr bool is_steady = true;
+
+    static time_point
+    now() noexcept
+    {
+        if (tickers_.load(std::memory_order_relaxed) == 0) {
+            return base_clock::now();
+        }
+        return time_point{duration{tick_.load(std::memory_order_relaxed)}};
+    }
+
+    /**
+     * Keeps the cached time of coarse_clock up to date while it is alive.
+     */
+    class ticker {
+    public:
+        explicit ticker(std::chrono::milliseconds resolution = std::chrono::milliseconds{1})
+            : event_{[]() { update(); }, resolution, resolution}
+        {
+            update();
+            tickers_++;
+        }
+
+        ticker(ticker const&) = delete;
+        ticker&
+        operator=(ticker const&)
+            = delete;
+
+        ~ticker()
+        {
+            tickers_--;
+            event_.stop();
+        }
+
+    private:
+        func::interval_event event_;
+    };
+
+private:
+    static inline std::atomic<rep>         tick_{0};
+    static inline std::atomic<std::size_t> tickers_{0};
+
+    static void
+    update() noexcept
+    {
+        /* Several tickers may race, never let the cached time go backwards. */
+        auto const now     = base_clock::now().time_since_epoch().count();
+        auto       current = tick_.load(std::memory_order_relaxed);
+        while ((current < now) && !tick_.compare_exchange_weak(current, now, std::memory_order_relaxed)) {}
+    }
+};
+
+}    // namespace xitren::cache
@@ -36,4 +36,16 @@ public:
     }
 };
 
+class cache_closed : public std::exception {
+public:
+    cache_closed() : std::exception() {}
+
+    char const*
+    what() const noexcept override
+    {
+        static char const* problem = "Cache was destroyed before the value was loaded!";
+        return problem;
+    }
+};
+
 }    // namespace xitren::cache
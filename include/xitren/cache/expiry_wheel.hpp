@@ -0,0 +1,119 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace xitren::cache {
+
+/**
+ * @brief Hashed timing wheel over the entries of a cache map, used to reap expired entries incrementally.
+ *
+ * Node is the value_type of the cache map; node.second must have a deadline time point and an expiry member of
+ * type hook_type. Entries are linked intrusively into the bucket of their deadline tick, so scheduling never
+ * allocates. A reaping pass only visits the buckets whose ticks have passed since the previous pass, instead of
+ * the whole cache.
+ */
+template <class Node, class Clock, std::size_t Slots = 256>
+class expiry_wheel {
+    static_assert((Slots & (Slots - 1)) == 0, "Slots count must be a power of two");
+
+    using time_point = typename Clock::time_point;
+    using duration   = typename Clock::duration;
+
+public:
+    struct hook_type {
+        Node* prev{nullptr};
+        Node* next{nullptr};
+    };
+
+    explicit expiry_wheel(duration granularity) noexcept
+        : granularity_{std::max(granularity, duration{1})}, cursor_{tick(Clock::now())}
+    {}
+
+    void
+    schedule(Node* node) noexcept
+    {
+        auto& head          = buckets_[tick(node->second.deadline) & slot_mask];
+        node->second.expiry = {nullptr, head};
+        if (head != nullptr) {
+            head->second.expiry.prev = node;
+        }
+        head = node;
+    }
+
+    void
+    cancel(Node* node) noexcept
+    {
+        auto& hook = node->second.expiry;
+        if (hook.prev != nullptr) {
+            hook.prev->second.expiry.next = hook.next;
+        } else {
+            buckets_[tick(node->second.deadline) & slot_mask] = hook.next;
+        }
+        if (hook.next != nullptr) {
+            hook.next->second.expiry.prev = hook.prev;
+        }
+        hook = {};
+    }
+
+    /**
+     * Unlinks up to max_batch entries with a deadline before now and appends them to expired.
+     *
+     * Buckets are visited from the position of the previous pass up to the current tick, at most one full turn
+     * of the wheel. When the batch is exhausted the pass stops, and the next one resumes from the same bucket.
+     */
+    void
+    reap(time_point now, std::size_t max_batch, std::vector<Node*>& expired) noexcept
+    {
+        auto const  target = tick(now);
+        std::size_t found{};
+        for (std::size_t turn{}; cursor_ <= target; turn++) {
+            if (turn == Slots) {
+                /* Every bucket was checked against now during this pass. */
+                cursor_ = target;
+                break;
+            }
+            for (Node* node = buckets_[cursor_ & slot_mask]; node != nullptr;) {
+                Node* next = node->second.expiry.next;
+                if (node->second.deadline <= now) {
+                    if (found == max_batch) {
+                        return;
+                    }
+                    cancel(node);
+                    expired.push_back(node);
+                    found++;
+                }
+                node = next;
+            }
+            if (cursor_ == target) {
+                break;
+            }
+            cursor_++;
+        }
+    }
+
+private:
+    static constexpr std::size_t slot_mask = Slots - 1;
+
+    duration                 granularity_;
+    std::int64_t             cursor_;
+    std::array<Node*, Slots> buckets_{};
+
+    std::int64_t
+    tick(time_point time) const noexcept
+    {
+        return static_cast<std::int64_t>(time.time_since_epoch() / granularity_);
+    }
+};
+
+}    // namespace xitren::cache
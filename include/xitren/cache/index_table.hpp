@@ -0,0 +1,147 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace xitren::cache {
+
+/**
+ * @brief Fixed-size open-addressing index from keys to slot numbers.
+ *
+ * The table does not store keys itself: lookups receive a key_of(index) callable that returns the key kept in
+ * the caller's slot array. It has the next power of two above 2 * Size buckets, uses linear probing with
+ * Fibonacci hashing and backward-shift deletion, so it never needs tombstones or allocation.
+ *
+ * A Shared table reads and writes its buckets with relaxed atomic accesses, so find() may run while another
+ * thread changes the table. Such a lookup may then miss or return a stale bucket, and always ends after one pass
+ * over the table; the caller validates the result, as clock_cache does with its version counter.
+ */
+template <class Key, std::size_t Size, bool Shared = false>
+class index_table {
+public:
+    using index_type = std::uint32_t;
+
+    static_assert(Size > 0, "Table must contain at least one entry");
+    static_assert(Size < std::numeric_limits<index_type>::max() / 2, "Table size is too big for index type");
+
+    static constexpr index_type  npos       = std::numeric_limits<index_type>::max();
+    static constexpr std::size_t table_size = std::bit_ceil(Size * 2);
+
+    index_table() noexcept { table_.fill(npos); }
+
+    /**
+     * Returns the bucket that holds the key, or npos.
+     */
+    template <class KeyOf>
+    std::size_t
+    find(Key const& key, KeyOf&& key_of) const noexcept
+    {
+        for (std::size_t pos = home(key), probes{}; probes < table_size; pos = (pos + 1) & table_mask, probes++) {
+            /* Loaded once, as a shared bucket may be emptied between two loads. */
+            auto const idx = load(pos);
+            if (idx == npos) {
+                break;
+            }
+            if (key_of(idx) == key) {
+                return pos;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * Returns the slot number stored in the bucket.
+     */
+    index_type
+    operator[](std::size_t pos) const noexcept
+    {
+        return load(pos);
+    }
+
+    /**
+     * Inserts a key that is not yet present in the table.
+     */
+    void
+    insert(Key const& key, index_type idx) noexcept
+    {
+        std::size_t pos = home(key);
+        while (load(pos) != npos) {
+            pos = (pos + 1) & table_mask;
+        }
+        store(pos, idx);
+    }
+
+    template <class KeyOf>
+    void
+    erase(std::size_t hole, KeyOf&& key_of) noexcept
+    {
+        /* Shift back every following entry of the probe run that may legally occupy the hole. */
+        for (std::size_t pos = (hole + 1) & table_mask; load(pos) != npos; pos = (pos + 1) & table_mask) {
+            auto const ideal = home(key_of(load(pos)));
+            if (((pos - ideal) & table_mask) >= ((pos - hole) & table_mask)) {
+                store(hole, load(pos));
+                hole = pos;
+            }
+        }
+        store(hole, npos);
+    }
+
+    void
+    clear() noexcept
+    {
+        if constexpr (Shared) {
+            for (std::size_t pos{}; pos < table_size; pos++) {
+                store(pos, npos);
+            }
+        } else {
+            table_.fill(npos);
+        }
+    }
+
+    static std::size_t
+    home(Key const& key) noexcept
+    {
+        /* Fibonacci hashing spreads identity hashes (e.g. of integers) over the whole table. */
+        std::uint64_t const hash = std::hash<Key>{}(key);
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> (64 - table_bits));
+    }
+
+private:
+    static constexpr std::size_t table_mask = table_size - 1;
+    static constexpr int         table_bits = std::countr_zero(table_size);
+
+    std::array<index_type, table_size> table_{};
+
+    index_type
+    load(std::size_t pos) const noexcept
+    {
+        if constexpr (Shared) {
+            return std::atomic_ref<index_type>{const_cast<index_type&>(table_[pos])}.load(std::memory_order_relaxed);
+        } else {
+            return table_[pos];
+        }
+    }
+
+    void
+    store(std::size_t pos, index_type idx) noexcept
+    {
+        if constexpr (Shared) {
+            std::atomic_ref<index_type>{table_[pos]}.store(idx, std::memory_order_relaxed);
+        } else {
+            table_[pos] = idx;
+        }
+    }
+};
+
+}    // namespace xitren::cache
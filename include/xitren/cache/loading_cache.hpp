@@ -0,0 +1,227 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/exceptions.hpp>
+#include <xitren/cache/transparent_hash.hpp>
+
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace xitren::cache {
+
+template <class Cache>
+concept loadable_cache = requires(Cache cache, typename Cache::key_type key, typename Cache::mapped_type value) {
+    cache.get(key);
+    cache.put(key, value);
+};
+
+/**
+ * @brief Read-through cache: misses are filled by calling a loader, once per key however many callers miss it.
+ *
+ * Concurrent misses of the same key are coalesced into a single flight: the first caller runs the loader and
+ * stores the result in the cache, the others wait for it. If the loader throws, every waiter gets the exception
+ * and nothing is cached.
+ *
+ * With a refresh period, a hit on an entry older than that period returns the cached value at once and queues a
+ * reload on a background thread, so a hot key is replaced before it expires and callers never block on it. The
+ * refresh period should therefore be shorter than the expiry period of the cache.
+ *
+ * The cache is referenced, not owned, and has to be thread-safe (e.g. sharded_lru). The loader may be called
+ * concurrently for different keys. Refreshes still queued when the loading cache is destroyed are dropped, and
+ * callers waiting for them get cache_closed.
+ */
+template <loadable_cache Cache, class Loader>
+    requires std::invocable<Loader&, typename Cache::key_type const&>
+             && std::convertible_to<std::invoke_result_t<Loader&, typename Cache::key_type const&>,
+                                    typename Cache::mapped_type>
+class loading_cache {
+    using key_type    = typename Cache::key_type;
+    using value_type  = typename Cache::mapped_type;
+    using future_type = std::shared_future<value_type>;
+
+    struct flight_type {
+        std::promise<value_type> promise{};
+        future_type              result{promise.get_future().share()};
+    };
+
+    using flight_map = std::unordered_map<key_type, flight_type, transparent_hash<key_type>, std::equal_to<>>;
+
+public:
+    static constexpr std::chrono::milliseconds no_refresh = std::chrono::milliseconds::max();
+
+    loading_cache(Cache& cache, Loader loader, std::chrono::milliseconds refresh_after = no_refresh)
+        : cache_{cache}, loader_{std::move(loader)}, refresh_after_{refresh_after}
+    {
+        if (refresh_after_ != no_refresh) {
+            worker_ = std::thread{[this]() { refresh_loop(); }};
+        }
+    }
+
+    loading_cache(loading_cache const&) = delete;
+    loading_cache&
+    operator=(loading_cache const&)
+        = delete;
+
+    /**
+     * Stops the refresh thread after the refresh it is running. Refreshes still queued are not run: callers waiting
+     * for them get cache_closed.
+     */
+    ~loading_cache()
+    {
+        if (worker_.joinable()) {
+            {
+                std::unique_lock<std::mutex> lock(access_);
+                stop_ = true;
+            }
+            queued_.notify_one();
+            worker_.join();
+        }
+        for (auto const& key : refreshes_) {
+            flights_.extract(key).mapped().promise.set_exception(std::make_exception_ptr(cache_closed()));
+        }
+    }
+
+    /**
+     * Returns the cached value of the key, loading it on a miss.
+     *
+     * @throws whatever the loader throws, if the key had to be loaded and the load failed.
+     */
+    value_type
+    get(key_type const& key)
+    {
+        if (auto item = cached(key); item) {
+            if (stale(std::get<2>(*item))) {
+                refresh(key);
+            }
+            return std::get<1>(std::move(*item));
+        }
+        return load(key);
+    }
+
+    /**
+     * Returns the number of loads and refreshes in flight.
+     */
+    std::size_t
+    in_flight()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return flights_.size();
+    }
+
+private:
+    Cache&                          cache_;
+    Loader                          loader_;
+    const std::chrono::milliseconds refresh_after_;
+    std::mutex                      access_{};
+    flight_map                      flights_{};
+    std::deque<key_type>            refreshes_{};
+    std::condition_variable         queued_{};
+    bool                            stop_{false};
+    std::thread                     worker_{};
+
+    auto
+    cached(key_type const& key)
+    {
+        try {
+            return cache_.get(key);
+        } catch (cache_timeout const&) {
+            return decltype(cache_.get(key)){};
+        }
+    }
+
+    /* The timestamp is the time the entry was stored, on the clock of the cache. */
+    template <class Timestamp>
+    bool
+    stale(Timestamp stored) const
+    {
+        return (refresh_after_ != no_refresh) && ((Timestamp::clock::now() - stored) >= refresh_after_);
+    }
+
+    value_type
+    load(key_type const& key)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        if (auto found = flights_.find(key); found != flights_.end()) {
+            auto result = found->second.result;
+            lock.unlock();
+            return result.get();
+        }
+        /* The previous flight may have stored the value after our miss but before we took the lock. */
+        if (auto item = cached(key); item) {
+            return std::get<1>(std::move(*item));
+        }
+        auto result = flights_[key].result;
+        lock.unlock();
+        fly(key);
+        return result.get();
+    }
+
+    void
+    refresh(key_type const& key)
+    {
+        {
+            std::unique_lock<std::mutex> lock(access_);
+            if (!flights_.try_emplace(key).second) {
+                return;
+            }
+            refreshes_.push_back(key);
+        }
+        queued_.notify_one();
+    }
+
+    /* Runs the loader for a flight registered in flights_ and resolves it. */
+    void
+    fly(key_type const& key)
+    {
+        std::optional<value_type> value;
+        std::exception_ptr        error;
+        try {
+            value.emplace(loader_(key));
+            cache_.put(key, *value);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        std::unique_lock<std::mutex> lock(access_);
+        auto                         flight = flights_.extract(key);
+        lock.unlock();
+        if (error) {
+            flight.mapped().promise.set_exception(error);
+        } else {
+            flight.mapped().promise.set_value(std::move(*value));
+        }
+    }
+
+    void
+    refresh_loop()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        for (;;) {
+            queued_.wait(lock, [this]() { return stop_ || !refreshes_.empty(); });
+            if (stop_) {
+                return;
+            }
+            auto key = std::move(refreshes_.front());
+            refreshes_.pop_front();
+            lock.unlock();
+            fly(key);
+            lock.lock();
+        }
+    }
+};
+
+}    // namespace xitren::cache
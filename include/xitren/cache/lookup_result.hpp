@@ -0,0 +1,126 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace xitren::cache {
+
+enum class lookup_status : std::uint8_t { hit, miss, expired };
+
+/**
+ * @brief Outcome of a cache lookup that never throws: the value on a hit, or why there is none.
+ *
+ * Modelled on std::expected with lookup_status as the error. With a reference type (lookup_result<Value&>) it
+ * points to the value inside the cache and is only valid until the next modifying call on the cache; with a
+ * value type it owns a copy. Either way a miss is a status byte and nothing else.
+ */
+template <class T>
+class [[nodiscard]] lookup_result {
+    static constexpr bool by_reference = std::is_reference_v<T>;
+
+public:
+    using value_type = std::remove_reference_t<T>;
+
+    constexpr lookup_result(lookup_status status) noexcept : status_{status} { assert(status != lookup_status::hit); }
+
+    constexpr lookup_result(value_type& value) noexcept
+        requires by_reference
+        : status_{lookup_status::hit}, value_{std::addressof(value)}
+    {}
+
+    constexpr lookup_result(value_type value)
+        requires(!by_reference)
+        : status_{lookup_status::hit}, value_{std::move(value)}
+    {}
+
+    constexpr lookup_status
+    status() const noexcept
+    {
+        return status_;
+    }
+
+    constexpr bool
+    has_value() const noexcept
+    {
+        return status_ == lookup_status::hit;
+    }
+
+    constexpr explicit
+    operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    constexpr bool
+    expired() const noexcept
+    {
+        return status_ == lookup_status::expired;
+    }
+
+    /**
+     * Returns the value, which must be present (has_value()).
+     */
+    constexpr value_type&
+    value() noexcept
+    {
+        assert(has_value());
+        return *value_;
+    }
+
+    constexpr value_type const&
+    value() const noexcept
+    {
+        assert(has_value());
+        return *value_;
+    }
+
+    template <class U>
+    constexpr std::remove_cv_t<value_type>
+    value_or(U&& other) const
+    {
+        return has_value() ? *value_ : static_cast<std::remove_cv_t<value_type>>(std::forward<U>(other));
+    }
+
+    constexpr value_type&
+    operator*() noexcept
+    {
+        return value();
+    }
+
+    constexpr value_type const&
+    operator*() const noexcept
+    {
+        return value();
+    }
+
+    constexpr value_type*
+    operator->() noexcept
+    {
+        return std::addressof(value());
+    }
+
+    constexpr value_type const*
+    operator->() const noexcept
+    {
+        return std::addressof(value());
+    }
+
+private:
+    using storage_type = std::conditional_t<by_reference, value_type*, std::optional<value_type>>;
+
+    lookup_status status_;
+    storage_type  value_{};
+};
+
+}    // namespace xitren::cache
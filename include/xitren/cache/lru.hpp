@@ -7,78 +7,470 @@ __ _(_) |_ _ _ ___ _ _
 */
 #pragma once
 #include <xitren/cache/exceptions.hpp>
+#include <xitren/cache/expiry_wheel.hpp>
+#include <xitren/cache/lookup_result.hpp>
+#include <xitren/cache/policies/eviction_policy.hpp>
+#include <xitren/cache/policies/lru_policy.hpp>
+#include <xitren/cache/snapshot.hpp>
+#include <xitren/cache/stats.hpp>
+#include <xitren/cache/transparent_hash.hpp>
+#include <xitren/cache/weigher.hpp>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <filesystem>
+#include <functional>
 #include <list>
 #include <mutex>
+#include <iterator>
+#include <memory>
 #include <optional>
+#include <ranges>
+#include <span>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace xitren::cache {
 
-template <class Key, class Value, std::size_t Size, bool Exception = true>
+/**
+ * Reason an entry left the cache, as reported to a removal listener.
+ */
+enum class removal_cause : std::uint8_t { evicted, expired, replaced };
+
+/**
+ * @brief LRU cache of at most Size entries, which expire after a period.
+ *
+ * The replacement order is given by Policy. A Weigher additionally assigns every entry a weight (e.g. its size in
+ * bytes): once the total weight exceeds the budget given to the constructor, entries are evicted in the order of
+ * the policy until it fits again. An entry heavier than the whole budget is evicted right after it is stored.
+ *
+ * Stats selects whether hits, misses, evictions and expirations are counted: no_stats (the default) costs
+ * nothing, cache_stats keeps counters that stats() reports.
+ */
+template <class Key, class Value, std::size_t Size, bool Exception = true,
+          template <class, std::size_t> class Policy = lru_policy, class Clock = std::chrono::steady_clock,
+          class Weigher = unit_weigher, class Stats = no_stats>
+    requires eviction_policy<Policy<Key, Size>, Key> && Clock::is_steady && weigher<Weigher, Key, Value>
 class lru {
-    using timestamp          = std::chrono::time_point<std::chrono::system_clock>;
-    using data_item          = std::tuple<Key, Value, timestamp>;
-    using double_linked_list = std::list<data_item>;
-    using hash_map           = std::unordered_map<Key, data_item>;
-    using return_type        = std::optional<data_item>;
+    using clock_type  = Clock;
+    using timestamp   = typename clock_type::time_point;
+    using period_type = typename clock_type::duration;
+    using data_item   = std::tuple<Key, Value, timestamp>;
+    using policy_type = Policy<Key, Size>;
+    using hook_type   = typename policy_type::hook_type;
+
+    struct entry_type;
+    using node_type  = std::pair<Key const, entry_type>;
+    using wheel_type = expiry_wheel<node_type, clock_type>;
+
+    /* Every item is stored once, in the map. The policy keeps its own ordering over pointers to the map keys
+     * and the hook lets it find an entry in O(1). */
+    struct entry_type {
+        template <class... Args>
+        entry_type(timestamp now, timestamp expires, Args&&... args)
+            : value(std::forward<Args>(args)...), time{now}, used{now}, deadline{expires}
+        {}
+
+        Value                          value;
+        timestamp                      time;
+        timestamp                      used;
+        timestamp                      deadline;
+        std::size_t                    weight{};
+        hook_type                      hook{};
+        typename wheel_type::hook_type expiry{};
+    };
+
+    /* std::equal_to<> with a transparent hash allows lookups by any type comparable with Key. */
+    using hash_map    = std::unordered_map<Key, entry_type, transparent_hash<Key>, std::equal_to<>>;
+    using return_type = std::optional<data_item>;
+
+    /* A wheel tick is 1/64 of the default TTL, so one turn of the wheel covers four default lifetimes. */
+    static constexpr std::size_t wheel_resolution = 64;
+    /* Batches are resolved in windows of this many keys: the bucket heads of a whole window are loaded before the
+     * first key is compared. The loads do not depend on each other, so their cache misses overlap. */
+    static constexpr std::size_t batch_window = 16;
 
 public:
-    explicit lru(timestamp expired) noexcept : expired_after_{expired} {}
+    using key_type         = Key;
+    using mapped_type      = Value;
+    using removal_listener = std::function<void(Key const&, Value&, removal_cause)>;
 
+    explicit lru(period_type expired, std::size_t max_weight = unlimited_weight, Weigher weigher = {})
+        : expired_after_{expired}, max_weight_{max_weight}, weigher_{std::move(weigher)},
+          wheel_{expired / wheel_resolution}
+    {
+        map_.reserve(Size + 1);
+    }
+
+    /**
+     * Inserts or updates the key, which then expires after the default period given to the constructor.
+     */
     void
     put(Key key, Value value)
+    {
+        put(std::move(key), std::move(value), expired_after_);
+    }
+
+    /**
+     * Inserts or updates the key, which then expires after ttl.
+     */
+    void
+    put(Key key, Value value, period_type ttl)
     {
 #ifdef PTHREAD_MUTEX_DEFAULT
         std::unique_lock<std::mutex> lock(access_);
 #endif
-        if (map_.contains(key)) {
-            auto is_key = [key](data_item item) { return item.template get<0>() == key; };
-            auto it     = std::find_if(list_.begin(), list_.end(), is_key);
-            if (it != list_.end()) {
-                auto obj = *it;
-                list_.erase(it);
-                list_.push_front(obj);
-                map_[key] = obj;
-            } else {
-                if constexpr (Exception) {
-                    throw cache_missed();
-                }
+        store(std::move(key), ttl, true, std::move(value));
+    }
+
+    /**
+     * Inserts or updates every key-value pair under a single lock, locating their buckets a window at a time.
+     */
+    template <std::ranges::random_access_range Items>
+        requires std::same_as<std::ranges::range_value_t<Items>, std::pair<Key, Value>>
+    void
+    put_many(Items const& items)
+    {
+        put_many(items, expired_after_);
+    }
+
+    template <std::ranges::random_access_range Items>
+        requires std::same_as<std::ranges::range_value_t<Items>, std::pair<Key, Value>>
+    void
+    put_many(Items const& items, period_type ttl)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto const first = std::ranges::begin(items);
+        auto const count = static_cast<std::size_t>(std::ranges::size(items));
+        for (std::size_t window = 0; window < count; window += batch_window) {
+            auto const end = std::min(count, window + batch_window);
+            for (std::size_t i = window; i < end; i++) {
+                locate_bucket(first[i].first);
             }
-        } else {
-            if (list_.size() >= Size) {
-                list_.pop_back();
+            for (std::size_t i = window; i < end; i++) {
+                auto const& [key, value] = first[i];
+                store(Key(key), ttl, true, value);
             }
-            auto obj = data_item{key, value, get_time()};
-            list_.push_front(obj);
-            map_[key] = obj;
         }
     }
 
+    /**
+     * Inserts or updates the key, constructing the value in place from args.
+     */
+    template <class... Args>
+    void
+    emplace(Key key, Args&&... args)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        store(std::move(key), expired_after_, true, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Constructs the value in place from args only if the key is not cached yet (or has expired).
+     *
+     * @return true if the value was inserted.
+     */
+    template <class... Args>
+    bool
+    try_emplace(Key key, Args&&... args)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        return store(std::move(key), expired_after_, false, std::forward<Args>(args)...);
+    }
+
+    template <class K>
     return_type
-    get(Key key)
+    get(K const& key)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto* node = lookup(key);
+        if (node == nullptr) {
+            return std::nullopt;
+        }
+        return data_item{node->first, node->second.value, node->second.time};
+    }
+
+    /**
+     * Looks up all keys under a single lock and writes one result per key, in order, to out.
+     *
+     * The buckets of the keys are located a window at a time before they are resolved. Expired
+     * keys are reported as misses even if Exception is set, so one expired key does not discard the whole batch.
+     *
+     * @return the number of hits.
+     */
+    template <std::ranges::random_access_range Keys, std::output_iterator<return_type> Out>
+        requires std::same_as<std::ranges::range_value_t<Keys>, Key>
+    std::size_t
+    get_many(Keys const& keys, Out out)
     {
 #ifdef PTHREAD_MUTEX_DEFAULT
         std::unique_lock<std::mutex> lock(access_);
 #endif
-        if (map_.contains(key)) {
-            auto [value, time] = map_[key];
-            if ((get_time() - time).count() >= expired_after_) {
-                if constexpr (Exception) {
-                    throw cache_timeout();
+        auto const                            now   = get_time();
+        auto const                            first = std::ranges::begin(keys);
+        auto const                            count = static_cast<std::size_t>(std::ranges::size(keys));
+        std::array<std::size_t, batch_window> buckets;
+        std::size_t                           hits{};
+        for (std::size_t window = 0; window < count; window += batch_window) {
+            auto const end = std::min(count, window + batch_window);
+            for (std::size_t i = window; i < end; i++) {
+                buckets[i - window] = locate_bucket(first[i]);
+            }
+            for (std::size_t i = window; i < end; i++) {
+                Key const& key  = first[i];
+                auto       node = resolve(key, find_in(key, buckets[i - window]), now);
+                if (!node) {
+                    *out = std::nullopt;
+                } else {
+                    *out = data_item{node->first, node->second.value, node->second.time};
+                    hits++;
                 }
-                return std::nullopt;
+                ++out;
             }
-        } else {
-            return std::nullopt;
+        }
+        return hits;
+    }
+
+    std::vector<return_type>
+    get_many(std::span<Key const> keys)
+    {
+        std::vector<return_type> results;
+        results.reserve(keys.size());
+        get_many(keys, std::back_inserter(results));
+        return results;
+    }
+
+    /**
+     * Looks the key up without ever throwing or copying: the result refers to the cached value on a hit and
+     * tells a miss from an expired entry otherwise, whatever Exception is set to.
+     *
+     * Like find, the reference is only valid until the next modifying call on the cache.
+     */
+    template <class K>
+    lookup_result<Value&>
+    try_get(K const& key)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto found  = map_.find(key);
+        auto result = resolve(key, (found == map_.end()) ? nullptr : &*found, get_time());
+        if (!result) {
+            return result.status();
+        }
+        return result->second.value;
+    }
+
+    /**
+     * Like get, but returns a pointer to the cached value instead of a copy, or nullptr on a miss.
+     *
+     * The pointer stays valid until the entry is evicted, expires or is replaced, so it must not be kept across
+     * other modifying calls on the cache.
+     */
+    template <class K>
+    Value*
+    find(K const& key)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto* node = lookup(key);
+        return (node == nullptr) ? nullptr : &node->second.value;
+    }
+
+    /**
+     * Marks the key as most recently used without copying its value.
+     *
+     * @return true if the key is present in the cache and has not expired.
+     */
+    template <class K>
+    bool
+    touch(K const& key)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto found = map_.find(key);
+        if (found == map_.end()) {
+            stats_.miss();
+            return false;
+        }
+        auto const now = get_time();
+        if (now >= found->second.deadline) {
+            stats_.miss();
+            stats_.expiration();
+            erase(found, removal_cause::expired);
+            return false;
+        }
+        stats_.hit();
+        found->second.used = now;
+        policy_.touch(found->second.hook);
+        return true;
+    }
+
+    /**
+     * Removes up to max_batch expired entries, without scanning the whole cache.
+     *
+     * Expired entries are dropped lazily when they are accessed anyway; this reclaims the memory of the ones that
+     * are never accessed again. Call it periodically, e.g. through a reaper.
+     *
+     * @return the number of removed entries.
+     */
+    std::size_t
+    reap(std::size_t max_batch)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        expired_.clear();
+        wheel_.reap(get_time(), max_batch, expired_);
+        for (auto* node : expired_) {
+            stats_.expiration();
+            policy_.erase(node->second.hook);
+            drop(map_.find(node->first), removal_cause::expired);
+        }
+        return expired_.size();
+    }
+
+    /**
+     * Writes all unexpired entries, least recently used first, to a snapshot that restore can load after a restart.
+     */
+    void
+    save(snapshot_writer<Key, Value>& writer)
+        requires snapshot_compatible<Key, Value>
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto const              now = get_time();
+        std::vector<node_type*> nodes;
+        nodes.reserve(map_.size());
+        for (auto& node : map_) {
+            if (now < node.second.deadline) {
+                nodes.push_back(&node);
+            }
+        }
+        std::ranges::sort(nodes, {}, [](node_type const* node) { return node->second.used; });
+        for (auto const* node : nodes) {
+            writer.add(node->first, node->second.value,
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(node->second.deadline - now));
         }
     }
 
+    /**
+     * Saves the cache to file, see save(snapshot_writer&).
+     *
+     * @return false if the file could not be written.
+     */
+    bool
+    save(std::filesystem::path const& file)
+        requires snapshot_compatible<Key, Value>
+    {
+        snapshot_writer<Key, Value> writer{file};
+        save(writer);
+        return writer.commit();
+    }
+
+    /**
+     * Maps a snapshot written by save and puts its entries back with their remaining time to live, in one pass.
+     * Entries that have expired since the snapshot was taken are skipped.
+     *
+     * @return the number of restored entries.
+     */
+    std::size_t
+    restore(std::filesystem::path const& file)
+        requires snapshot_compatible<Key, Value>
+    {
+        snapshot_reader<Key, Value> reader{file};
+        std::size_t                 restored{};
+        reader.for_each([this, &restored](Key const& key, Value const& value, std::chrono::nanoseconds ttl) {
+            put(key, value, std::chrono::duration_cast<period_type>(ttl));
+            restored++;
+        });
+        return restored;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return map_.size();
+    }
+
+    /**
+     * Returns the total weight of the cached entries, as given by the Weigher.
+     */
+    std::size_t
+    weight() const noexcept
+    {
+        return weight_;
+    }
+
+    std::size_t
+    max_weight() const noexcept
+    {
+        return max_weight_;
+    }
+
+    /**
+     * Returns a pointer to the cached value like find, but without counting as an access: the replacement order
+     * and the statistics are left alone, and an expired entry is reported as missing without being dropped.
+     */
+    template <class K>
+    Value*
+    peek(K const& key)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto found = map_.find(key);
+        if ((found == map_.end()) || (get_time() >= found->second.deadline)) {
+            return nullptr;
+        }
+        return &found->second.value;
+    }
+
+    /**
+     * Sets a function called with every entry that leaves the cache, right before it is destroyed.
+     *
+     * The listener runs inside the cache operation that removed the entry, so it must not call back into the
+     * cache. It may move the value out.
+     */
+    void
+    on_removal(removal_listener listener)
+    {
+        removal_listener_ = std::move(listener);
+    }
+
+    /**
+     * Returns the counters (all zero unless Stats is cache_stats) together with the current size and weight.
+     *
+     * Like the counters, size and weight are read from relaxed atomic copies, so a monitoring thread may take a
+     * snapshot while the cache is in use.
+     */
+    stats_snapshot
+    stats() const noexcept
+    {
+        auto result   = stats_.snapshot();
+        result.size   = published_size_.load(std::memory_order_relaxed);
+        result.weight = published_weight_.load(std::memory_order_relaxed);
+        return result;
+    }
+
     auto
     expired_after() const
     {
@@ -86,9 +478,18 @@ public:
     }
 
 private:
-    const timestamp    expired_after_;
-    double_linked_list list_{};
-    hash_map           map_{};
+    const period_type             expired_after_;
+    const std::size_t             max_weight_;
+    [[no_unique_address]] Weigher weigher_;
+    std::size_t                   weight_{};
+    hash_map                      map_{};
+    policy_type                   policy_{};
+    wheel_type                    wheel_;
+    std::vector<node_type*>       expired_{};
+    [[no_unique_address]] Stats   stats_{};
+    std::atomic<std::size_t>      published_size_{};
+    std::atomic<std::size_t>      published_weight_{};
+    removal_listener              removal_listener_{};
 #ifdef PTHREAD_MUTEX_DEFAULT
     std::mutex access_{};
 #endif
@@ -96,8 +497,180 @@ private:
     inline timestamp
     get_time()
     {
-        return std::chrono::system_clock::now();
+        return clock_type::now();
+    }
+
+    template <class... Args>
+    static constexpr bool assignable_from = (sizeof...(Args) == 1) && (std::is_assignable_v<Value&, Args> && ...);
+
+    template <class... Args>
+    bool
+    store(Key&& key, period_type ttl, bool replace, Args&&... args)
+    {
+        auto const now = get_time();
+        policy_.record(key);
+        if (auto found = map_.find(key); found != map_.end()) {
+            auto& node = *found;
+            if (!replace && (now < node.second.deadline)) {
+                return false;
+            }
+            if constexpr (assignable_from<Args...> || std::is_move_assignable_v<Value>) {
+                wheel_.cancel(&node);
+                if constexpr (assignable_from<Args...>) {
+                    (..., (node.second.value = std::forward<Args>(args)));
+                } else {
+                    node.second.value = Value(std::forward<Args>(args)...);
+                }
+                node.second.time     = now;
+                node.second.used     = now;
+                node.second.deadline = now + ttl;
+                reweigh(node);
+                wheel_.schedule(&node);
+                policy_.touch(node.second.hook);
+                fit_weight();
+                return true;
+            } else {
+                /* Values that cannot be assigned are replaced by constructing a new entry. */
+                erase(found, removal_cause::replaced);
+            }
+        }
+        auto [it, inserted] = map_.try_emplace(std::move(key), now, now + ttl, std::forward<Args>(args)...);
+        reweigh(*it);
+        wheel_.schedule(&*it);
+        if (auto const victim = policy_.insert(&it->first, it->second.hook); victim != nullptr) {
+            evict(victim);
+        }
+        fit_weight();
+        return true;
+    }
+
+    void
+    reweigh(node_type& node)
+    {
+        weight_ -= node.second.weight;
+        node.second.weight = static_cast<std::size_t>(weigher_(node.first, node.second.value));
+        weight_ += node.second.weight;
+        publish();
+    }
+
+    /* Removes the entry of a key the policy has already dropped. */
+    void
+    evict(Key const* victim)
+    {
+        auto evicted = map_.find(*victim);
+        stats_.eviction();
+        wheel_.cancel(&*evicted);
+        drop(evicted, removal_cause::evicted);
+    }
+
+    void
+    fit_weight()
+    {
+        while (weight_ > max_weight_) {
+            auto const victim = policy_.evict();
+            if (victim == nullptr) {
+                return;
+            }
+            evict(victim);
+        }
+    }
+
+    void
+    drop(typename hash_map::iterator found, removal_cause cause)
+    {
+        if (removal_listener_) {
+            removal_listener_(found->first, found->second.value, cause);
+        }
+        weight_ -= found->second.weight;
+        map_.erase(found);
+        publish();
+    }
+
+    /* Every insert is reweighed and every removal dropped, so those two keep the copies read by stats() current. */
+    void
+    publish() noexcept
+    {
+        published_size_.store(map_.size(), std::memory_order_relaxed);
+        published_weight_.store(weight_, std::memory_order_relaxed);
+    }
+
+    template <class K>
+    node_type*
+    lookup(K const& key)
+    {
+        auto found  = map_.find(key);
+        auto result = resolve(key, (found == map_.end()) ? nullptr : &*found, get_time());
+        if constexpr (Exception) {
+            if (result.expired()) {
+                throw cache_timeout();
+            }
+        }
+        return result ? &*result : nullptr;
+    }
+
+    /* Records the access and checks the found node (or nullptr on a miss). Expired nodes are dropped. */
+    template <class K>
+    lookup_result<node_type&>
+    resolve(K const& key, node_type* node, timestamp now)
+    {
+        policy_.record(key);
+        if (node == nullptr) {
+            stats_.miss();
+            return lookup_status::miss;
+        }
+        if (now >= node->second.deadline) {
+            stats_.miss();
+            stats_.expiration();
+            erase(map_.find(node->first), removal_cause::expired);
+            return lookup_status::expired;
+        }
+        stats_.hit();
+        node->second.used = now;
+        policy_.touch(node->second.hook);
+        return *node;
+    }
+
+    /*
+     * Hashes the key and loads the head of its bucket; only the first node of the bucket is prefetched.
+     * std::unordered_map does not expose its bucket array, so the array slot and the node before the head are
+     * reached with ordinary loads, which a window of keys issues independently of each other.
+     */
+    std::size_t
+    locate_bucket(Key const& key) const
+    {
+        auto const bucket = map_.bucket(key);
+        if (auto const head = map_.begin(bucket); head != map_.end(bucket)) {
+            prefetch(std::addressof(*head));
+        }
+        return bucket;
+    }
+
+    node_type*
+    find_in(Key const& key, std::size_t bucket)
+    {
+        for (auto it = map_.begin(bucket); it != map_.end(bucket); ++it) {
+            if (map_.key_eq()(it->first, key)) {
+                return std::addressof(*it);
+            }
+        }
+        return nullptr;
+    }
+
+    static void
+    prefetch([[maybe_unused]] void const* address) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#endif
+    }
+
+    void
+    erase(typename hash_map::iterator found, removal_cause cause)
+    {
+        wheel_.cancel(&*found);
+        policy_.erase(found->second.hook);
+        drop(found, cause);
     }
 };
 
-}    // namespace xitren::cache
\ No newline at end of file
+}    // namespace xitren::cache
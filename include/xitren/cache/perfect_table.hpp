@@ -0,0 +1,215 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/lookup_result.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace xitren::cache {
+
+/**
+ * @brief Hash usable in constant expressions, for integral, enum and string keys.
+ */
+template <class Key>
+struct constexpr_hash;
+
+template <class Key>
+    requires std::integral<Key> || std::is_enum_v<Key>
+struct constexpr_hash<Key> {
+    constexpr std::uint64_t
+    operator()(Key key) const noexcept
+    {
+        /* splitmix64 finalizer */
+        auto value = static_cast<std::uint64_t>(key);
+        value      = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value      = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+};
+
+template <>
+struct constexpr_hash<std::string_view> {
+    constexpr std::uint64_t
+    operator()(std::string_view key) const noexcept
+    {
+        /* FNV-1a, then the integral finalizer to spread the low entropy of short strings */
+        std::uint64_t value = 0xCBF29CE484222325ULL;
+        for (auto const symbol : key) {
+            value = (value ^ static_cast<std::uint8_t>(symbol)) * 0x100000001B3ULL;
+        }
+        return constexpr_hash<std::uint64_t>{}(value);
+    }
+};
+
+/**
+ * @brief Read-only map over a key set fixed at compile time, built around a perfect hash.
+ *
+ * The constructor is consteval: it runs the hash-and-displace construction (keys are hashed into buckets, and
+ * every bucket, largest first, gets a seed that moves all its keys to free slots) while compiling, and rejects
+ * duplicate keys. A lookup is therefore one hash, one seed load and one key compare, without probing, and a
+ * table declared static constexpr lives in read-only memory. There is no insertion, eviction or expiry.
+ *
+ * Key and Value have to be literal and default-constructible; for string keys use std::string_view.
+ */
+template <class Key, class Value, std::size_t N, class Hash = constexpr_hash<Key>>
+    requires(N > 0)
+class perfect_table {
+    static constexpr std::size_t table_size  = std::bit_ceil(N + N / 4);
+    static constexpr std::size_t bucket_size = std::bit_ceil(std::max<std::size_t>(1, N / 2));
+    static constexpr int         bucket_bits = std::countr_zero(bucket_size);
+    static constexpr std::size_t max_seed    = std::size_t{1} << 20;
+
+    struct slot_type {
+        Key   key{};
+        Value value{};
+        bool  used{};
+    };
+
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+    using item_type   = std::pair<Key, Value>;
+
+    consteval explicit perfect_table(std::array<item_type, N> const& items)
+    {
+        std::array<std::uint64_t, N>               hashes{};
+        std::array<std::size_t, bucket_size + 1> offsets{};
+        for (std::size_t i = 0; i < N; i++) {
+            hashes[i] = Hash{}(items[i].first);
+            offsets[bucket_of(hashes[i]) + 1]++;
+        }
+        for (std::size_t bucket = 0; bucket < bucket_size; bucket++) {
+            offsets[bucket + 1] += offsets[bucket];
+        }
+        std::array<std::size_t, N> order{};
+        auto                       next = offsets;
+        for (std::size_t i = 0; i < N; i++) {
+            order[next[bucket_of(hashes[i])]++] = i;
+        }
+
+        std::array<std::size_t, bucket_size> buckets{};
+        for (std::size_t bucket = 0; bucket < bucket_size; bucket++) {
+            buckets[bucket] = bucket;
+        }
+        std::ranges::sort(buckets, [&offsets](std::size_t left, std::size_t right) {
+            return (offsets[left + 1] - offsets[left]) > (offsets[right + 1] - offsets[right]);
+        });
+
+        std::array<std::size_t, N> placed{};
+        for (auto const bucket : buckets) {
+            auto const first = offsets[bucket];
+            auto const last  = offsets[bucket + 1];
+            for (auto i = first; i < last; i++) {
+                for (auto j = first; j < i; j++) {
+                    if (items[order[i]].first == items[order[j]].first) {
+                        throw "perfect_table: duplicate key";
+                    }
+                }
+            }
+            std::uint32_t seed = 0;
+            while (!place(hashes, order, first, last, seed, placed)) {
+                if (++seed == max_seed) {
+                    throw "perfect_table: no perfect hash found, try another Hash";
+                }
+            }
+            seeds_[bucket] = seed;
+            for (auto i = first; i < last; i++) {
+                auto& slot = slots_[placed[i - first]];
+                slot.key   = items[order[i]].first;
+                slot.value = items[order[i]].second;
+                slot.used  = true;
+            }
+        }
+    }
+
+    template <class K>
+    constexpr Value const*
+    find(K const& key) const noexcept
+    {
+        auto const  hash = Hash{}(key);
+        auto const& slot = slots_[slot_of(hash, seeds_[bucket_of(hash)])];
+        return (slot.used && (slot.key == key)) ? &slot.value : nullptr;
+    }
+
+    template <class K>
+    constexpr lookup_result<Value const&>
+    try_get(K const& key) const noexcept
+    {
+        if (auto const* value = find(key); value != nullptr) {
+            return *value;
+        }
+        return lookup_status::miss;
+    }
+
+    template <class K>
+    constexpr bool
+    contains(K const& key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    static constexpr std::size_t
+    size() noexcept
+    {
+        return N;
+    }
+
+private:
+    std::array<std::uint32_t, bucket_size> seeds_{};
+    std::array<slot_type, table_size>      slots_{};
+
+    static constexpr std::size_t
+    bucket_of(std::uint64_t hash) noexcept
+    {
+        if constexpr (bucket_bits == 0) {
+            return 0;
+        } else {
+            return static_cast<std::size_t>(hash >> (64 - bucket_bits));
+        }
+    }
+
+    static constexpr std::size_t
+    slot_of(std::uint64_t hash, std::uint32_t seed) noexcept
+    {
+        auto value = hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+        value      = (value ^ (value >> 32)) * 0xD6E8FEB86659FD93ULL;
+        return static_cast<std::size_t>(value ^ (value >> 32)) & (table_size - 1);
+    }
+
+    /* Tries to put the keys order[first, last) into free, distinct slots with seed, listing them in placed. */
+    constexpr bool
+    place(std::array<std::uint64_t, N> const& hashes, std::array<std::size_t, N> const& order, std::size_t first,
+          std::size_t last, std::uint32_t seed, std::array<std::size_t, N>& placed) const
+    {
+        for (auto i = first; i < last; i++) {
+            auto const slot = slot_of(hashes[order[i]], seed);
+            if (slots_[slot].used) {
+                return false;
+            }
+            for (auto j = first; j < i; j++) {
+                if (placed[j - first] == slot) {
+                    return false;
+                }
+            }
+            placed[i - first] = slot;
+        }
+        return true;
+    }
+};
+
+template <class Key, class Value, std::size_t N>
+perfect_table(std::array<std::pair<Key, Value>, N> const&) -> perfect_table<Key, Value, N>;
+
+}    // namespace xitren::cache
@@ -0,0 +1,143 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/policies/ghost_list.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+
+namespace xitren::cache {
+
+/**
+ * @brief Adaptive Replacement Cache (Megiddo & Modha).
+ *
+ * Resident keys live either in T1 (seen once recently) or T2 (seen at least twice). Keys evicted from them are
+ * remembered in the ghost lists B1 and B2, and a hit in a ghost list moves the target size p of T1 towards the
+ * list that would have kept the key. Scans only churn T1, while the frequently used keys in T2 survive.
+ */
+template <class Key, std::size_t Size>
+class arc_policy {
+    struct node_type {
+        Key const* key;
+        bool       frequent;
+    };
+
+    using list_type = std::list<node_type>;
+
+public:
+    using hook_type = typename list_type::iterator;
+
+    template <class K>
+    void
+    record(K const&) noexcept
+    {}
+
+    void
+    touch(hook_type& hook) noexcept
+    {
+        t2_.splice(t2_.begin(), hook->frequent ? t2_ : t1_, hook);
+        hook->frequent = true;
+    }
+
+    Key const*
+    insert(Key const* key, hook_type& hook)
+    {
+        Key const* victim = nullptr;
+        if (b1_.contains(*key)) {
+            p_ = std::min(Size, p_ + std::max<std::size_t>(b2_.size() / b1_.size(), 1));
+            b1_.erase(*key);
+            victim = replace(false);
+            t2_.push_front({key, true});
+            hook = t2_.begin();
+            return victim;
+        }
+        if (b2_.contains(*key)) {
+            auto const delta = std::max<std::size_t>(b1_.size() / b2_.size(), 1);
+            p_               = p_ > delta ? p_ - delta : 0;
+            b2_.erase(*key);
+            victim = replace(true);
+            t2_.push_front({key, true});
+            hook = t2_.begin();
+            return victim;
+        }
+        if (t1_.size() + b1_.size() >= Size) {
+            if (t1_.size() < Size) {
+                b1_.pop_back();
+                victim = replace(false);
+            } else {
+                victim = t1_.back().key;
+                t1_.pop_back();
+            }
+        } else if (t1_.size() + t2_.size() + b1_.size() + b2_.size() >= Size) {
+            if (t1_.size() + t2_.size() + b1_.size() + b2_.size() >= 2 * Size) {
+                b2_.pop_back();
+            }
+            victim = replace(false);
+        }
+        t1_.push_front({key, false});
+        hook = t1_.begin();
+        return victim;
+    }
+
+    Key const*
+    evict()
+    {
+        return (t1_.empty() && t2_.empty()) ? nullptr : demote(false);
+    }
+
+    void
+    erase(hook_type& hook) noexcept
+    {
+        (hook->frequent ? t2_ : t1_).erase(hook);
+    }
+
+    /**
+     * Returns the current target size of T1.
+     */
+    std::size_t
+    target() const noexcept
+    {
+        return p_;
+    }
+
+private:
+    list_type       t1_{};
+    list_type       t2_{};
+    ghost_list<Key> b1_{Size};
+    ghost_list<Key> b2_{Size};
+    std::size_t     p_{};
+
+    Key const*
+    replace(bool in_b2)
+    {
+        if (t1_.size() + t2_.size() < Size) {
+            return nullptr;
+        }
+        return demote(in_b2);
+    }
+
+    /* Moves the tail of T1 or T2, as chosen by the target p, to its ghost list. */
+    Key const*
+    demote(bool in_b2)
+    {
+        Key const* victim;
+        if (!t1_.empty() && (t2_.empty() || (t1_.size() > p_) || (in_b2 && (t1_.size() == p_)))) {
+            victim = t1_.back().key;
+            t1_.pop_back();
+            b1_.push_front(*victim);
+        } else {
+            victim = t2_.back().key;
+            t2_.pop_back();
+            b2_.push_front(*victim);
+        }
+        return victim;
+    }
+};
+
+}    // namespace xitren::cache
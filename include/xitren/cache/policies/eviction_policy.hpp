@@ -0,0 +1,39 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <concepts>
+
+namespace xitren::cache {
+
+/**
+ * @brief Interface of a replacement policy of the lru cache.
+ *
+ * The cache owns the entries and keeps a policy specific hook_type in each of them. Policies only see pointers
+ * to the keys stored in the cache, which stay valid until the entry is erased.
+ *
+ * - record(key) is called for every lookup, hit or miss, before anything else. The key may be of any type the
+ *   cache accepts for heterogeneous lookup, so it should be a template.
+ * - touch(hook) is called on a hit.
+ * - insert(key, hook) registers a new entry and returns the key of the resident entry that has to be evicted to
+ *   keep at most Size entries, or nullptr.
+ * - evict() drops the entry the policy would replace next and returns its key, or nullptr if it tracks none.
+ *   It is used when the cache has to shrink below Size, e.g. to fit its weight budget.
+ * - erase(hook) forgets an entry the cache removed by itself (e.g. because it has expired).
+ */
+template <class Policy, class Key>
+concept eviction_policy
+    = requires(Policy policy, Key const& key, Key const* ptr, typename Policy::hook_type& hook) {
+          policy.record(key);
+          policy.touch(hook);
+          { policy.insert(ptr, hook) } -> std::same_as<Key const*>;
+          { policy.evict() } -> std::same_as<Key const*>;
+          policy.erase(hook);
+      };
+
+}    // namespace xitren::cache
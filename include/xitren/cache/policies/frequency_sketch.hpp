@@ -0,0 +1,88 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/transparent_hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace xitren::cache {
+
+/**
+ * @brief Count-min sketch estimating how often a key was seen recently, as used by TinyLFU admission.
+ *
+ * Counters are saturating 4-bit values in depth rows of a power-of-two width. After every 10 * Size recorded
+ * events all counters are halved, so the estimate follows the recent popularity instead of the whole history.
+ */
+template <class Key, std::size_t Size>
+class frequency_sketch {
+    static constexpr std::size_t  depth       = 4;
+    static constexpr std::size_t  width       = std::bit_ceil(std::max<std::size_t>(Size, 16));
+    static constexpr int          width_bits  = std::countr_zero(width);
+    static constexpr std::size_t  sample_size = 10 * Size;
+    static constexpr std::uint8_t max_count   = 15;
+
+    static constexpr std::array<std::uint64_t, depth> seeds
+        = {0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL, 0xD6E8FEB86659FD93ULL};
+
+public:
+    frequency_sketch() : table_(depth * width) {}
+
+    template <class K>
+    void
+    increment(K const& key)
+    {
+        std::uint64_t const hash = transparent_hash<Key>{}(key);
+        for (std::size_t row{}; row < depth; row++) {
+            auto& counter = table_[row * width + index(hash, row)];
+            if (counter < max_count) {
+                counter++;
+            }
+        }
+        if (++samples_ >= sample_size) {
+            age();
+        }
+    }
+
+    template <class K>
+    std::uint8_t
+    frequency(K const& key) const
+    {
+        std::uint64_t const hash  = transparent_hash<Key>{}(key);
+        std::uint8_t        count = max_count;
+        for (std::size_t row{}; row < depth; row++) {
+            count = std::min(count, table_[row * width + index(hash, row)]);
+        }
+        return count;
+    }
+
+private:
+    std::vector<std::uint8_t> table_;
+    std::size_t               samples_{};
+
+    static std::size_t
+    index(std::uint64_t hash, std::size_t row) noexcept
+    {
+        return static_cast<std::size_t>(((hash + row) * seeds[row]) >> (64 - width_bits));
+    }
+
+    void
+    age() noexcept
+    {
+        for (auto& counter : table_) {
+            counter >>= 1;
+        }
+        samples_ /= 2;
+    }
+};
+
+}    // namespace xitren::cache
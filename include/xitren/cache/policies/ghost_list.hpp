@@ -0,0 +1,82 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+namespace xitren::cache {
+
+/**
+ * @brief Bounded recency list of keys that were recently evicted, used by adaptive policies as history.
+ *
+ * Only the keys are kept, so a ghost entry costs no value storage. Pushing beyond the capacity drops the oldest
+ * key.
+ */
+template <class Key>
+class ghost_list {
+    using list_type = std::list<Key>;
+    using hash_map  = std::unordered_map<Key, typename list_type::iterator>;
+
+public:
+    explicit ghost_list(std::size_t capacity) : capacity_{capacity} { map_.reserve(capacity); }
+
+    void
+    push_front(Key const& key)
+    {
+        if (capacity_ == 0) {
+            return;
+        }
+        if (list_.size() >= capacity_) {
+            pop_back();
+        }
+        list_.push_front(key);
+        map_.emplace(key, list_.begin());
+    }
+
+    void
+    pop_back()
+    {
+        if (!list_.empty()) {
+            map_.erase(list_.back());
+            list_.pop_back();
+        }
+    }
+
+    bool
+    contains(Key const& key) const
+    {
+        return map_.contains(key);
+    }
+
+    bool
+    erase(Key const& key)
+    {
+        auto found = map_.find(key);
+        if (found == map_.end()) {
+            return false;
+        }
+        list_.erase(found->second);
+        map_.erase(found);
+        return true;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return list_.size();
+    }
+
+private:
+    std::size_t capacity_;
+    list_type   list_{};
+    hash_map    map_{};
+};
+
+}    // namespace xitren::cache
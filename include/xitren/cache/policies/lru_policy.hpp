@@ -0,0 +1,70 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <cstdint>
+#include <list>
+
+namespace xitren::cache {
+
+/**
+ * @brief Classic least recently used replacement: a single recency list, the tail is evicted.
+ */
+template <class Key, std::size_t Size>
+class lru_policy {
+    using list_type = std::list<Key const*>;
+
+public:
+    using hook_type = typename list_type::iterator;
+
+    template <class K>
+    void
+    record(K const&) noexcept
+    {}
+
+    void
+    touch(hook_type& hook) noexcept
+    {
+        list_.splice(list_.begin(), list_, hook);
+    }
+
+    Key const*
+    insert(Key const* key, hook_type& hook)
+    {
+        Key const* victim = nullptr;
+        if (list_.size() >= Size) {
+            victim = list_.back();
+            list_.pop_back();
+        }
+        list_.push_front(key);
+        hook = list_.begin();
+        return victim;
+    }
+
+    Key const*
+    evict() noexcept
+    {
+        if (list_.empty()) {
+            return nullptr;
+        }
+        Key const* victim = list_.back();
+        list_.pop_back();
+        return victim;
+    }
+
+    void
+    erase(hook_type& hook) noexcept
+    {
+        list_.erase(hook);
+    }
+
+private:
+    list_type list_{};
+};
+
+}    // namespace xitren::cache
@@ -0,0 +1,151 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/policies/frequency_sketch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
+
+namespace xitren::cache {
+
+/**
+ * @brief W-TinyLFU replacement (Einziger, Friedman & Manes).
+ *
+ * New keys enter a small LRU window of 1% of the capacity. A key leaving the window only gets into the main
+ * segmented LRU (probation and protected, 80% of main) if the frequency sketch says it was accessed more often
+ * than the entry it would replace; otherwise the candidate itself is evicted. Bursts are absorbed by the window
+ * and scans are rejected by the admission filter.
+ */
+template <class Key, std::size_t Size>
+class tiny_lfu_policy {
+    enum class segment : std::uint8_t { window, probation, protect };
+
+    struct node_type {
+        Key const* key;
+        segment    where;
+    };
+
+    using list_type = std::list<node_type>;
+
+    static constexpr std::size_t window_size  = std::max<std::size_t>(1, Size / 100);
+    static constexpr std::size_t main_size    = Size - window_size;
+    static constexpr std::size_t protect_size = main_size * 4 / 5;
+
+public:
+    using hook_type = typename list_type::iterator;
+
+    template <class K>
+    void
+    record(K const& key)
+    {
+        sketch_.increment(key);
+    }
+
+    void
+    touch(hook_type& hook) noexcept
+    {
+        switch (hook->where) {
+        case segment::window:
+            window_.splice(window_.begin(), window_, hook);
+            break;
+        case segment::probation:
+            hook->where = segment::protect;
+            protect_.splice(protect_.begin(), probation_, hook);
+            if (protect_.size() > protect_size) {
+                auto demoted   = std::prev(protect_.end());
+                demoted->where = segment::probation;
+                probation_.splice(probation_.begin(), protect_, demoted);
+            }
+            break;
+        case segment::protect:
+            protect_.splice(protect_.begin(), protect_, hook);
+            break;
+        }
+    }
+
+    Key const*
+    insert(Key const* key, hook_type& hook)
+    {
+        window_.push_front({key, segment::window});
+        hook = window_.begin();
+        if (window_.size() <= window_size) {
+            return (resident() > Size) ? evict_main() : nullptr;
+        }
+        /* The window overflows: its oldest entry has to win against the main victim to stay. */
+        auto       candidate = std::prev(window_.end());
+        Key const* victim    = nullptr;
+        if (resident() > Size) {
+            Key const* main_victim = main_tail();
+            if ((main_victim == nullptr) || (sketch_.frequency(*candidate->key) <= sketch_.frequency(*main_victim))) {
+                victim = candidate->key;
+                window_.erase(candidate);
+                return victim;
+            }
+            victim = evict_main();
+        }
+        candidate->where = segment::probation;
+        probation_.splice(probation_.begin(), window_, candidate);
+        return victim;
+    }
+
+    Key const*
+    evict()
+    {
+        return (resident() == 0) ? nullptr : evict_main();
+    }
+
+    void
+    erase(hook_type& hook) noexcept
+    {
+        switch (hook->where) {
+        case segment::window:
+            window_.erase(hook);
+            break;
+        case segment::probation:
+            probation_.erase(hook);
+            break;
+        case segment::protect:
+            protect_.erase(hook);
+            break;
+        }
+    }
+
+private:
+    list_type                   window_{};
+    list_type                   probation_{};
+    list_type                   protect_{};
+    frequency_sketch<Key, Size> sketch_{};
+
+    std::size_t
+    resident() const noexcept
+    {
+        return window_.size() + probation_.size() + protect_.size();
+    }
+
+    Key const*
+    main_tail() const noexcept
+    {
+        if (!probation_.empty()) {
+            return probation_.back().key;
+        }
+        return protect_.empty() ? nullptr : protect_.back().key;
+    }
+
+    Key const*
+    evict_main()
+    {
+        auto&      from   = !probation_.empty() ? probation_ : (!protect_.empty() ? protect_ : window_);
+        Key const* victim = from.back().key;
+        from.pop_back();
+        return victim;
+    }
+};
+
+}    // namespace xitren::cache
@@ -0,0 +1,105 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/policies/ghost_list.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+
+namespace xitren::cache {
+
+/**
+ * @brief Full 2Q replacement (Johnson & Shasha).
+ *
+ * New keys enter a FIFO queue A1in of a quarter of the capacity. Keys evicted from it are remembered in the ghost
+ * queue A1out, and only a key that comes back while still remembered is admitted into the LRU queue Am. A single
+ * sequential scan therefore only cycles through A1in and never flushes the hot set in Am.
+ */
+template <class Key, std::size_t Size>
+class two_queue_policy {
+    enum class queue : std::uint8_t { in, main };
+
+    struct node_type {
+        Key const* key;
+        queue      where;
+    };
+
+    using list_type = std::list<node_type>;
+
+    static constexpr std::size_t in_size  = std::max<std::size_t>(1, Size / 4);
+    static constexpr std::size_t out_size = std::max<std::size_t>(1, Size / 2);
+
+public:
+    using hook_type = typename list_type::iterator;
+
+    template <class K>
+    void
+    record(K const&) noexcept
+    {}
+
+    void
+    touch(hook_type& hook) noexcept
+    {
+        /* A1in is a FIFO, a hit there does not change the order. */
+        if (hook->where == queue::main) {
+            main_.splice(main_.begin(), main_, hook);
+        }
+    }
+
+    Key const*
+    insert(Key const* key, hook_type& hook)
+    {
+        Key const* victim = nullptr;
+        if (in_.size() + main_.size() >= Size) {
+            victim = reclaim();
+        }
+        if (out_.erase(*key)) {
+            main_.push_front({key, queue::main});
+            hook = main_.begin();
+        } else {
+            in_.push_front({key, queue::in});
+            hook = in_.begin();
+        }
+        return victim;
+    }
+
+    Key const*
+    evict()
+    {
+        return (in_.empty() && main_.empty()) ? nullptr : reclaim();
+    }
+
+    void
+    erase(hook_type& hook) noexcept
+    {
+        (hook->where == queue::in ? in_ : main_).erase(hook);
+    }
+
+private:
+    list_type       in_{};
+    list_type       main_{};
+    ghost_list<Key> out_{out_size};
+
+    Key const*
+    reclaim()
+    {
+        Key const* victim;
+        if (in_.size() > in_size || main_.empty()) {
+            victim = in_.back().key;
+            in_.pop_back();
+            out_.push_front(*victim);
+        } else {
+            victim = main_.back().key;
+            main_.pop_back();
+        }
+        return victim;
+    }
+};
+
+}    // namespace xitren::cache
@@ -0,0 +1,46 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/func/interval_event.hpp>
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+
+namespace xitren::cache {
+
+template <class Cache>
+concept reapable_cache = requires(Cache cache, std::size_t batch) {
+    { cache.reap(batch) } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * @brief Background task that removes expired entries of a cache in bounded batches.
+ *
+ * Every period it calls cache.reap(max_batch) from its own thread, so the cache has to be thread-safe (e.g.
+ * sharded_lru). The batch bound keeps the time the cache is locked by the reaper short.
+ */
+template <reapable_cache Cache>
+class reaper {
+public:
+    reaper(Cache& cache, std::chrono::milliseconds period, std::size_t max_batch = 64)
+        : event_{[&cache, max_batch]() { cache.reap(max_batch); }, period, period}
+    {}
+
+    reaper(reaper const&) = delete;
+    reaper&
+    operator=(reaper const&)
+        = delete;
+
+    ~reaper() { event_.stop(); }
+
+private:
+    func::interval_event event_;
+};
+
+}    // namespace xitren::cache
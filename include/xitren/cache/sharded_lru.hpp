@@ -0,0 +1,371 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/lru.hpp>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace xitren::cache {
+
+/**
+ * @brief Thread-safe LRU cache split into independent shards.
+ *
+ * Keys are hashed to one of Shards lru instances of Size / Shards entries each. Every shard has its own mutex
+ * and replacement policy state and sits on its own cache line, so threads working on different shards never
+ * contend. Recency is tracked per shard, so eviction is LRU (or Policy) within a shard only. Likewise the weight
+ * budget is split evenly between the shards.
+ */
+template <class Key, class Value, std::size_t Size, std::size_t Shards, bool Exception = true,
+          template <class, std::size_t> class Policy = lru_policy, class Clock = std::chrono::steady_clock,
+          class Weigher = unit_weigher, class Stats = no_stats>
+class sharded_lru {
+    static_assert(Shards > 0 && std::has_single_bit(Shards), "Shards count must be a power of two");
+    static_assert(Size >= Shards, "Every shard must hold at least one entry");
+
+    static constexpr std::size_t cache_line = 64;
+    static constexpr std::size_t shard_size = (Size + Shards - 1) / Shards;
+    static constexpr int         shard_bits = std::countr_zero(Shards);
+
+    using clock_type  = Clock;
+    using timestamp   = typename clock_type::time_point;
+    using period_type = typename clock_type::duration;
+    using data_item   = std::tuple<Key, Value, timestamp>;
+    using return_type = std::optional<data_item>;
+    using shard_cache = lru<Key, Value, shard_size, Exception, Policy, Clock, Weigher, Stats>;
+
+    struct alignas(cache_line) shard_type {
+        shard_type(period_type expired, std::size_t max_weight, Weigher const& weigher)
+            : cache{expired, max_weight, weigher}
+        {}
+
+        std::mutex  access{};
+        shard_cache cache;
+    };
+
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+
+    explicit sharded_lru(period_type expired, std::size_t max_weight = unlimited_weight, Weigher const& weigher = {})
+        : expired_after_{expired},
+          shards_{make_shards(expired, shard_weight(max_weight), weigher, std::make_index_sequence<Shards>{})}
+    {}
+
+    void
+    put(Key key, Value value)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        shard.cache.put(std::move(key), std::move(value));
+    }
+
+    void
+    put(Key key, Value value, period_type ttl)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        shard.cache.put(std::move(key), std::move(value), ttl);
+    }
+
+    /**
+     * Inserts or updates every key-value pair, locking each shard that receives any of them once.
+     */
+    void
+    put_many(std::span<std::pair<Key, Value> const> items)
+    {
+        put_many(items, expired_after_);
+    }
+
+    void
+    put_many(std::span<std::pair<Key, Value> const> items, period_type ttl)
+    {
+        using item_type = std::pair<Key, Value>;
+        for_each_shard(items, [](item_type const& item) -> Key const& { return item.first; },
+                       [&items, ttl](shard_type& shard, auto run) {
+                           auto const item_at = [&items](std::size_t i) -> item_type const& { return items[i]; };
+                           shard.cache.put_many(run | std::views::transform(item_at), ttl);
+                       });
+    }
+
+    template <class... Args>
+    void
+    emplace(Key key, Args&&... args)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        shard.cache.emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    bool
+    try_emplace(Key key, Args&&... args)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        return shard.cache.try_emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <class K>
+    return_type
+    get(K const& key)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * Looks the key up without throwing, see lru::try_get. The value is copied out while the shard is locked.
+     */
+    template <class K>
+    lookup_result<Value>
+    try_get(K const& key)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        auto                         result = shard.cache.try_get(key);
+        if (!result) {
+            return result.status();
+        }
+        return *result;
+    }
+
+    /**
+     * Looks up all keys, locking each shard that owns any of them once. Results are in the order of keys.
+     *
+     * Expired keys are reported as misses even if Exception is set, see lru::get_many.
+     */
+    std::vector<return_type>
+    get_many(std::span<Key const> keys)
+    {
+        std::vector<return_type> results(keys.size());
+        for_each_shard(keys, [](Key const& key) -> Key const& { return key; },
+                       [&keys, &results](shard_type& shard, auto run) {
+                           auto const key_at    = [&keys](std::size_t i) -> Key const& { return keys[i]; };
+                           auto const result_at = [&results](std::size_t i) -> return_type& { return results[i]; };
+                           auto       targets   = run | std::views::transform(result_at);
+                           shard.cache.get_many(run | std::views::transform(key_at), targets.begin());
+                       });
+        return results;
+    }
+
+    /**
+     * Calls func with a reference to the cached value while its shard is locked, without copying it.
+     *
+     * @return true if the key was found and func was called.
+     */
+    template <class K, class Func>
+    bool
+    visit(K const& key, Func&& func)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        if (auto* value = shard.cache.find(key); value != nullptr) {
+            std::forward<Func>(func)(*value);
+            return true;
+        }
+        return false;
+    }
+
+    template <class K>
+    bool
+    touch(K const& key)
+    {
+        auto&                        shard = shard_for(key);
+        std::unique_lock<std::mutex> lock(shard.access);
+        return shard.cache.touch(key);
+    }
+
+    /**
+     * Removes up to max_batch expired entries from every shard, locking one shard at a time.
+     *
+     * @return the number of removed entries.
+     */
+    std::size_t
+    reap(std::size_t max_batch)
+    {
+        std::size_t total{};
+        for (auto& shard : shards_) {
+            std::unique_lock<std::mutex> lock(shard.access);
+            total += shard.cache.reap(max_batch);
+        }
+        return total;
+    }
+
+    /**
+     * Saves all shards to one snapshot file, locking one shard at a time, see lru::save.
+     *
+     * @return false if the file could not be written.
+     */
+    bool
+    save(std::filesystem::path const& file)
+        requires snapshot_compatible<Key, Value>
+    {
+        snapshot_writer<Key, Value> writer{file};
+        for (auto& shard : shards_) {
+            std::unique_lock<std::mutex> lock(shard.access);
+            shard.cache.save(writer);
+        }
+        return writer.commit();
+    }
+
+    /**
+     * Puts the entries of a snapshot back into their shards, see lru::restore.
+     *
+     * @return the number of restored entries.
+     */
+    std::size_t
+    restore(std::filesystem::path const& file)
+        requires snapshot_compatible<Key, Value>
+    {
+        snapshot_reader<Key, Value> reader{file};
+        std::size_t                 restored{};
+        reader.for_each([this, &restored](Key const& key, Value const& value, std::chrono::nanoseconds ttl) {
+            put(key, value, std::chrono::duration_cast<period_type>(ttl));
+            restored++;
+        });
+        return restored;
+    }
+
+    /**
+     * Returns the number of entries in all shards. Each shard is locked in turn, so the result is not a
+     * consistent snapshot while other threads are writing.
+     */
+    std::size_t
+    size()
+    {
+        std::size_t total{};
+        for (auto& shard : shards_) {
+            std::unique_lock<std::mutex> lock(shard.access);
+            total += shard.cache.size();
+        }
+        return total;
+    }
+
+    /**
+     * Returns the total weight of the entries in all shards, locking each shard in turn like size().
+     */
+    std::size_t
+    weight()
+    {
+        std::size_t total{};
+        for (auto& shard : shards_) {
+            std::unique_lock<std::mutex> lock(shard.access);
+            total += shard.cache.weight();
+        }
+        return total;
+    }
+
+    /**
+     * Returns the sum of the statistics of all shards, see lru::stats. Shards are locked in turn.
+     */
+    stats_snapshot
+    stats()
+    {
+        stats_snapshot total{};
+        for (auto& shard : shards_) {
+            std::unique_lock<std::mutex> lock(shard.access);
+            total += shard.cache.stats();
+        }
+        return total;
+    }
+
+    static constexpr std::size_t
+    shards() noexcept
+    {
+        return Shards;
+    }
+
+    auto
+    expired_after() const
+    {
+        return expired_after_;
+    }
+
+private:
+    const period_type              expired_after_;
+    std::array<shard_type, Shards> shards_;
+
+    template <std::size_t... Index>
+    static std::array<shard_type, Shards>
+    make_shards(period_type expired, std::size_t max_weight, Weigher const& weigher, std::index_sequence<Index...>)
+    {
+        return {{((void)Index, shard_type{expired, max_weight, weigher})...}};
+    }
+
+    static constexpr std::size_t
+    shard_weight(std::size_t max_weight) noexcept
+    {
+        return (max_weight == unlimited_weight) ? unlimited_weight : (max_weight + Shards - 1) / Shards;
+    }
+
+    template <class K>
+    shard_type&
+    shard_for(K const& key) noexcept
+    {
+        return shards_[shard_index(key)];
+    }
+
+    template <class K>
+    static std::size_t
+    shard_index(K const& key) noexcept
+    {
+        if constexpr (Shards == 1) {
+            return 0;
+        } else {
+            /* Use the high bits of a Fibonacci hash, so shard choice is independent from the bucket choice of the
+             * shard map, which uses the low bits. */
+            std::uint64_t const hash = transparent_hash<Key>{}(key);
+            return (hash * 0x9E3779B97F4A7C15ULL) >> (64 - shard_bits);
+        }
+    }
+
+    /* Groups the positions of items by shard with a counting sort, then calls func once for every shard that
+     * owns any of them, with the shard locked and the span of the positions that belong to it. */
+    template <class Items, class KeyOf, class Func>
+    void
+    for_each_shard(Items const& items, KeyOf key_of, Func func)
+    {
+        std::array<std::size_t, Shards + 1> offsets{};
+        std::vector<std::size_t>            shard_of(items.size());
+        std::vector<std::size_t>            order(items.size());
+        for (std::size_t i = 0; i < items.size(); i++) {
+            shard_of[i] = shard_index(key_of(items[i]));
+            offsets[shard_of[i] + 1]++;
+        }
+        for (std::size_t shard = 0; shard < Shards; shard++) {
+            offsets[shard + 1] += offsets[shard];
+        }
+        auto next = offsets;
+        for (std::size_t i = 0; i < items.size(); i++) {
+            order[next[shard_of[i]]++] = i;
+        }
+        for (std::size_t shard = 0; shard < Shards; shard++) {
+            if (offsets[shard] == offsets[shard + 1]) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(shards_[shard].access);
+            func(shards_[shard], std::span<std::size_t const>{order}.subspan(offsets[shard],
+                                                                              offsets[shard + 1] - offsets[shard]));
+        }
+    }
+};
+
+}    // namespace xitren::cache
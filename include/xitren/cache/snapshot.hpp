@@ -0,0 +1,230 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define XITREN_CACHE_SNAPSHOT_MMAP 1
+#endif
+
+namespace xitren::cache {
+
+template <class Key, class Value>
+concept snapshot_compatible = std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>;
+
+/**
+ * @brief Layout of a cache snapshot file: a header followed by count fixed-size records.
+ *
+ * Records are stored from the least to the most recently used entry (written, read or touched), so restoring them
+ * in file order also restores their relative recency. Instead of a steady_clock deadline, which means nothing after
+ * a restart, every record keeps its remaining time to live at the moment given by written_at (system_clock).
+ */
+struct snapshot_header {
+    static constexpr std::array<char, 8> signature = {'X', 'C', 'A', 'C', 'H', 'E', 0, 1};
+
+    std::array<char, 8> magic;
+    std::uint32_t       key_size;
+    std::uint32_t       value_size;
+    std::uint64_t       count;
+    std::int64_t        written_at;
+};
+
+template <class Key, class Value>
+struct snapshot_record {
+    Key          key;
+    Value        value;
+    std::int64_t ttl;
+};
+
+/**
+ * @brief Writes a snapshot to a temporary file and moves it in place on commit, so a crash while saving never
+ * leaves a truncated snapshot behind.
+ */
+template <class Key, class Value>
+class snapshot_writer {
+    static_assert(snapshot_compatible<Key, Value>, "Snapshots hold raw copies of trivially copyable types only");
+
+    using record_type = snapshot_record<Key, Value>;
+
+public:
+    explicit snapshot_writer(std::filesystem::path file)
+        : file_{std::move(file)}, temporary_{file_.string() + ".tmp"}, stream_{temporary_, std::ios::binary}
+    {
+        snapshot_header header{};
+        stream_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    }
+
+    void
+    add(Key const& key, Value const& value, std::chrono::nanoseconds ttl)
+    {
+        record_type record;
+        std::memset(&record, 0, sizeof(record));
+        record.key   = key;
+        record.value = value;
+        record.ttl   = ttl.count();
+        stream_.write(reinterpret_cast<char const*>(&record), sizeof(record));
+        count_++;
+    }
+
+    /**
+     * Completes the header and replaces the snapshot file.
+     *
+     * @return false if anything could not be written.
+     */
+    bool
+    commit()
+    {
+        snapshot_header header{};
+        header.magic      = snapshot_header::signature;
+        header.key_size   = sizeof(Key);
+        header.value_size = sizeof(Value);
+        header.count      = count_;
+        header.written_at = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count();
+        stream_.seekp(0);
+        stream_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        stream_.close();
+        if (!stream_) {
+            return false;
+        }
+        std::error_code error;
+        std::filesystem::rename(temporary_, file_, error);
+        return !error;
+    }
+
+private:
+    std::filesystem::path file_;
+    std::filesystem::path temporary_;
+    std::ofstream         stream_;
+    std::uint64_t         count_{};
+};
+
+/**
+ * @brief Maps a snapshot file into memory and walks its records in a single pass.
+ *
+ * A missing file, or one written for other Key or Value types, reads as an empty snapshot.
+ */
+template <class Key, class Value>
+class snapshot_reader {
+    static_assert(snapshot_compatible<Key, Value>, "Snapshots hold raw copies of trivially copyable types only");
+
+    using record_type = snapshot_record<Key, Value>;
+
+public:
+    explicit snapshot_reader(std::filesystem::path const& file)
+    {
+        map(file);
+        if (bytes_.size() < sizeof(snapshot_header)) {
+            return;
+        }
+        std::memcpy(&header_, bytes_.data(), sizeof(header_));
+        if ((header_.magic != snapshot_header::signature) || (header_.key_size != sizeof(Key))
+            || (header_.value_size != sizeof(Value))
+            || (header_.count > (bytes_.size() - sizeof(snapshot_header)) / sizeof(record_type))) {
+            header_.count = 0;
+        }
+    }
+
+    snapshot_reader(snapshot_reader const&) = delete;
+    snapshot_reader&
+    operator=(snapshot_reader const&)
+        = delete;
+
+    ~snapshot_reader()
+    {
+#ifdef XITREN_CACHE_SNAPSHOT_MMAP
+        if (!bytes_.empty()) {
+            ::munmap(bytes_.data(), bytes_.size());
+        }
+#endif
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return header_.count;
+    }
+
+    /**
+     * Calls func(key, value, ttl) for every record that has not expired since the snapshot was written, with
+     * the remaining time to live.
+     */
+    template <class Func>
+    void
+    for_each(Func&& func) const
+    {
+        auto const now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::system_clock::now().time_since_epoch())
+                             .count();
+        auto const elapsed = std::max<std::int64_t>(0, now - header_.written_at);
+        auto const records = bytes_.subspan(sizeof(snapshot_header));
+        for (std::size_t i = 0; i < header_.count; i++) {
+            record_type record;
+            std::memcpy(&record, records.data() + i * sizeof(record_type), sizeof(record));
+            if (record.ttl > elapsed) {
+                func(record.key, record.value, std::chrono::nanoseconds{record.ttl - elapsed});
+            }
+        }
+    }
+
+private:
+    std::span<std::byte> bytes_{};
+    snapshot_header      header_{};
+#ifndef XITREN_CACHE_SNAPSHOT_MMAP
+    std::vector<std::byte> buffer_{};
+#endif
+
+    void
+    map(std::filesystem::path const& file)
+    {
+#ifdef XITREN_CACHE_SNAPSHOT_MMAP
+        int const descriptor = ::open(file.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            return;
+        }
+        struct stat info {};
+        if ((::fstat(descriptor, &info) == 0) && (info.st_size > 0)) {
+            auto const size    = static_cast<std::size_t>(info.st_size);
+            void*      address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (address != MAP_FAILED) {
+                ::madvise(address, size, MADV_SEQUENTIAL);
+                bytes_ = {static_cast<std::byte*>(address), size};
+            }
+        }
+        ::close(descriptor);
+#else
+        std::ifstream   stream{file, std::ios::binary | std::ios::ate};
+        std::streamsize size = stream ? static_cast<std::streamsize>(stream.tellg()) : 0;
+        if (size <= 0) {
+            return;
+        }
+        buffer_.resize(static_cast<std::size_t>(size));
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(buffer_.data()), size);
+        bytes_ = buffer_;
+#endif
+    }
+};
+
+}    // namespace xitren::cache
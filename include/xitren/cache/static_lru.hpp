@@ -0,0 +1,212 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/exceptions.hpp>
+#include <xitren/cache/index_table.hpp>
+
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <tuple>
+
+namespace xitren::cache {
+
+/**
+ * @brief LRU cache with the same interface as lru, but without any heap usage.
+ *
+ * All Size entries are preallocated in a contiguous array and linked into the recency list by index. Keys are
+ * found through an index_table, so put/get never allocate.
+ */
+template <std::default_initializable Key, std::default_initializable Value, std::size_t Size, bool Exception = true>
+class static_lru {
+    using clock_type  = std::chrono::steady_clock;
+    using timestamp   = std::chrono::time_point<clock_type>;
+    using period_type = clock_type::duration;
+    using data_item   = std::tuple<Key, Value, timestamp>;
+    using return_type = std::optional<data_item>;
+    using table_type  = index_table<Key, Size>;
+    using index_type  = typename table_type::index_type;
+
+    static constexpr index_type npos = table_type::npos;
+
+    struct slot_type {
+        Key        key{};
+        Value      value{};
+        timestamp  time{};
+        index_type prev{npos};
+        index_type next{npos};
+    };
+
+public:
+    explicit static_lru(period_type expired) noexcept : expired_after_{expired}
+    {
+        for (index_type i{}; i < Size; i++) {
+            slots_[i].next = i + 1;
+        }
+        slots_[Size - 1].next = npos;
+    }
+
+    void
+    put(Key key, Value value)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        if (auto const pos = table_.find(key, key_of()); pos != npos) {
+            auto& slot = slots_[table_[pos]];
+            slot.value = std::move(value);
+            slot.time  = get_time();
+            move_to_front(table_[pos]);
+            return;
+        }
+        index_type idx;
+        if (free_ != npos) {
+            idx   = free_;
+            free_ = slots_[idx].next;
+            size_++;
+        } else {
+            idx = tail_;
+            table_.erase(table_.find(slots_[idx].key, key_of()), key_of());
+            unlink(idx);
+        }
+        auto& slot = slots_[idx];
+        slot.key   = std::move(key);
+        slot.value = std::move(value);
+        slot.time  = get_time();
+        table_.insert(slot.key, idx);
+        push_front(idx);
+    }
+
+    return_type
+    get(Key key)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto const pos = table_.find(key, key_of());
+        if (pos == npos) {
+            return std::nullopt;
+        }
+        auto const idx  = table_[pos];
+        auto&      slot = slots_[idx];
+        if ((get_time() - slot.time) >= expired_after_) {
+            table_.erase(pos, key_of());
+            unlink(idx);
+            slot.next = free_;
+            free_     = idx;
+            size_--;
+            if constexpr (Exception) {
+                throw cache_timeout();
+            }
+            return std::nullopt;
+        }
+        move_to_front(idx);
+        return data_item{slot.key, slot.value, slot.time};
+    }
+
+    /**
+     * Marks the key as most recently used without copying its value.
+     *
+     * @return true if the key is present in the cache.
+     */
+    bool
+    touch(Key const& key)
+    {
+#ifdef PTHREAD_MUTEX_DEFAULT
+        std::unique_lock<std::mutex> lock(access_);
+#endif
+        auto const pos = table_.find(key, key_of());
+        if (pos == npos) {
+            return false;
+        }
+        move_to_front(table_[pos]);
+        return true;
+    }
+
+    std::size_t
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    auto
+    expired_after() const
+    {
+        return expired_after_;
+    }
+
+private:
+    const period_type           expired_after_;
+    std::array<slot_type, Size> slots_{};
+    table_type                  table_{};
+    index_type                  head_{npos};
+    index_type                  tail_{npos};
+    index_type                  free_{0};
+    std::size_t                 size_{};
+#ifdef PTHREAD_MUTEX_DEFAULT
+    std::mutex access_{};
+#endif
+
+    inline timestamp
+    get_time()
+    {
+        return clock_type::now();
+    }
+
+    auto
+    key_of() const noexcept
+    {
+        return [this](index_type idx) -> Key const& { return slots_[idx].key; };
+    }
+
+    void
+    unlink(index_type idx) noexcept
+    {
+        auto& slot = slots_[idx];
+        if (slot.prev != npos) {
+            slots_[slot.prev].next = slot.next;
+        } else {
+            head_ = slot.next;
+        }
+        if (slot.next != npos) {
+            slots_[slot.next].prev = slot.prev;
+        } else {
+            tail_ = slot.prev;
+        }
+        slot.prev = npos;
+        slot.next = npos;
+    }
+
+    void
+    push_front(index_type idx) noexcept
+    {
+        auto& slot = slots_[idx];
+        slot.prev  = npos;
+        slot.next  = head_;
+        if (head_ != npos) {
+            slots_[head_].prev = idx;
+        } else {
+            tail_ = idx;
+        }
+        head_ = idx;
+    }
+
+    void
+    move_to_front(index_type idx) noexcept
+    {
+        if (head_ != idx) {
+            unlink(idx);
+            push_front(idx);
+        }
+    }
+};
+
+}    // namespace xitren::cache
@@ -0,0 +1,136 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace xitren::cache {
+
+/**
+ * @brief Counters of a cache at one point in time.
+ */
+struct stats_snapshot {
+    std::uint64_t hits{};
+    std::uint64_t misses{};
+    std::uint64_t evictions{};
+    std::uint64_t expirations{};
+    std::size_t   size{};
+    std::size_t   weight{};
+
+    double
+    hit_ratio() const noexcept
+    {
+        auto const lookups = hits + misses;
+        return (lookups == 0) ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+
+    stats_snapshot&
+    operator+=(stats_snapshot const& other) noexcept
+    {
+        hits += other.hits;
+        misses += other.misses;
+        evictions += other.evictions;
+        expirations += other.expirations;
+        size += other.size;
+        weight += other.weight;
+        return *this;
+    }
+};
+
+/**
+ * @brief Statistics switched off: every call compiles to nothing and the counters read as zero.
+ */
+struct no_stats {
+    static constexpr bool enabled = false;
+
+    void
+    hit() noexcept
+    {}
+
+    void
+    miss() noexcept
+    {}
+
+    void
+    eviction() noexcept
+    {}
+
+    void
+    expiration() noexcept
+    {}
+
+    stats_snapshot
+    snapshot() const noexcept
+    {
+        return {};
+    }
+};
+
+/**
+ * @brief Hit, miss, eviction and expiration counters of a cache.
+ *
+ * A cache only updates its counters while it is accessed exclusively, so there is a single writer at a time and
+ * a relaxed load followed by a relaxed store is enough; no locked read-modify-write instruction is spent on the
+ * hot path. The counters are atomic, so a monitoring thread may read them while the cache is in use.
+ */
+class cache_stats {
+    using counter_type = std::atomic<std::uint64_t>;
+
+public:
+    static constexpr bool enabled = true;
+
+    void
+    hit() noexcept
+    {
+        increment(hits_);
+    }
+
+    void
+    miss() noexcept
+    {
+        increment(misses_);
+    }
+
+    void
+    eviction() noexcept
+    {
+        increment(evictions_);
+    }
+
+    void
+    expiration() noexcept
+    {
+        increment(expirations_);
+    }
+
+    stats_snapshot
+    snapshot() const noexcept
+    {
+        stats_snapshot result{};
+        result.hits        = hits_.load(std::memory_order_relaxed);
+        result.misses      = misses_.load(std::memory_order_relaxed);
+        result.evictions   = evictions_.load(std::memory_order_relaxed);
+        result.expirations = expirations_.load(std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    counter_type hits_{};
+    counter_type misses_{};
+    counter_type evictions_{};
+    counter_type expirations_{};
+
+    static void
+    increment(counter_type& counter) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+}    // namespace xitren::cache
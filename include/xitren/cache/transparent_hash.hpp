@@ -0,0 +1,42 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace xitren::cache {
+
+/**
+ * @brief Hash used by the caches for their keys.
+ *
+ * It is std::hash<Key>, except for strings where it is transparent: a std::string keyed cache can be searched
+ * with a std::string_view or a string literal without building a temporary std::string. Both overloads produce
+ * the same value, as the standard requires for std::hash of strings and string views.
+ */
+template <class Key>
+struct transparent_hash : std::hash<Key> {};
+
+template <class CharT, class Traits, class Allocator>
+struct transparent_hash<std::basic_string<CharT, Traits, Allocator>> {
+    using is_transparent = void;
+
+    /*
+     * Not noexcept on purpose: like std::hash<std::string>, a hash that may throw makes std::unordered_map keep the
+     * hash code in every node, so rehashing and bucket collisions do not hash whole strings again.
+     */
+    std::size_t
+    operator()(std::basic_string_view<CharT, Traits> key) const
+    {
+        return std::hash<std::basic_string_view<CharT, Traits>>{}(key);
+    }
+};
+
+}    // namespace xitren::cache
@@ -0,0 +1,44 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+namespace xitren::cache {
+
+/**
+ * @brief Cost of an entry, measured against the weight budget of a cache.
+ *
+ * A weigher is called once when an entry is stored (and again when its value is replaced) and must return the
+ * same weight for the same key and value, e.g. their size in bytes.
+ */
+template <class Weigher, class Key, class Value>
+concept weigher = requires(Weigher const& func, Key const& key, Value const& value) {
+    { func(key, value) } -> std::convertible_to<std::size_t>;
+};
+
+/**
+ * @brief Default weigher: every entry weighs 1, so the weight of a cache is its size.
+ */
+struct unit_weigher {
+    template <class Key, class Value>
+    constexpr std::size_t
+    operator()(Key const&, Value const&) const noexcept
+    {
+        return 1;
+    }
+};
+
+/**
+ * Weight budget that never triggers an eviction, only the entry count limit applies.
+ */
+inline constexpr std::size_t unlimited_weight = std::numeric_limits<std::size_t>::max();
+
+}    // namespace xitren::cache
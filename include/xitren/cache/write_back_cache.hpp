@@ -0,0 +1,231 @@
+/*!
+_ _
+__ _(_) |_ _ _ ___ _ _
+\ \ / |  _| '_/ -_) ' \
+/_\_\_|\__|_| \___|_||_|
+* @date 16.10.2026
+*/
+#pragma once
+#include <xitren/cache/lru.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace xitren::cache {
+
+template <class Sink, class Key, class Value>
+concept write_back_sink = std::invocable<Sink&, std::span<std::pair<Key, Value> const>>;
+
+/**
+ * @brief Thread-safe write buffer in front of a slow store: put only marks the entry dirty, the store is
+ * written later, in batches, and repeated writes of a key reach it once.
+ *
+ * Dirty entries are handed to the sink as a span of key-value pairs when they are evicted or expire, on flush(),
+ * and by a background thread as soon as more than max_dirty_ratio of the capacity is dirty; it then flushes
+ * batches until half of that bound is left. The sink is always called with the cache locked, so the store never
+ * sees the writes of a key out of order and a value is never missing from both the cache and the store. The
+ * destructor flushes everything that is still dirty.
+ */
+template <class Key, class Value, std::size_t Size, class Sink,
+          template <class, std::size_t> class Policy = lru_policy, class Clock = std::chrono::steady_clock>
+    requires write_back_sink<Sink, Key, Value>
+class write_back_cache {
+    using cache_type  = lru<Key, Value, Size, false, Policy, Clock>;
+    using item_type   = std::pair<Key, Value>;
+    using period_type = typename Clock::duration;
+    using key_set     = std::unordered_set<Key, transparent_hash<Key>, std::equal_to<>>;
+
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+
+    write_back_cache(period_type expired, Sink sink, std::size_t batch_size = 64, double max_dirty_ratio = 0.25)
+        : cache_{expired},
+          sink_{std::move(sink)},
+          batch_size_{std::max<std::size_t>(1, batch_size)},
+          max_dirty_{std::max<std::size_t>(1, static_cast<std::size_t>(max_dirty_ratio * Size))}
+    {
+        cache_.on_removal([this](Key const& key, Value& value, removal_cause cause) { removed(key, value, cause); });
+        batch_.reserve(batch_size_);
+        worker_ = std::thread{[this]() { flush_loop(); }};
+    }
+
+    write_back_cache(write_back_cache const&) = delete;
+    write_back_cache&
+    operator=(write_back_cache const&)
+        = delete;
+
+    ~write_back_cache()
+    {
+        {
+            std::unique_lock<std::mutex> lock(access_);
+            stop_ = true;
+        }
+        flushing_.notify_one();
+        worker_.join();
+        flush();
+    }
+
+    void
+    put(Key key, Value value)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        dirty_.insert(key);
+        cache_.put(std::move(key), std::move(value));
+        write_removed();
+        if (dirty_.size() > max_dirty_) {
+            flushing_.notify_one();
+        }
+    }
+
+    template <class K>
+    auto
+    get(K const& key)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        auto                         item = cache_.get(key);
+        write_removed();
+        return item;
+    }
+
+    template <class K>
+    bool
+    touch(K const& key)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        auto const                   found = cache_.touch(key);
+        write_removed();
+        return found;
+    }
+
+    /**
+     * Writes every dirty entry to the sink, batch_size entries per call. The entries stay cached, now clean.
+     *
+     * @return the number of entries written.
+     */
+    std::size_t
+    flush()
+    {
+        std::size_t written{};
+        for (;;) {
+            std::unique_lock<std::mutex> lock(access_);
+            if (dirty_.empty()) {
+                return written;
+            }
+            written += flush_batch();
+        }
+    }
+
+    /**
+     * Removes up to max_batch expired entries, writing the dirty ones back first.
+     */
+    std::size_t
+    reap(std::size_t max_batch)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        auto const                   reaped = cache_.reap(max_batch);
+        write_removed();
+        return reaped;
+    }
+
+    std::size_t
+    dirty()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return dirty_.size();
+    }
+
+    std::size_t
+    size()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return cache_.size();
+    }
+
+private:
+    cache_type              cache_;
+    Sink                    sink_;
+    const std::size_t       batch_size_;
+    const std::size_t       max_dirty_;
+    key_set                 dirty_{};
+    std::vector<item_type>  batch_{};
+    std::vector<item_type>  removed_{};
+    std::mutex              access_{};
+    std::condition_variable flushing_{};
+    bool                    stop_{false};
+    std::thread             worker_{};
+
+    /* Called by the cache for every entry that leaves it, dirty ones are written by write_removed(). */
+    void
+    removed(Key const& key, Value& value, removal_cause cause)
+    {
+        if ((cause != removal_cause::replaced) && (dirty_.erase(key) > 0)) {
+            removed_.emplace_back(key, std::move(value));
+        }
+    }
+
+    /* Returns the number of entries handed to the sink. */
+    std::size_t
+    write_removed()
+    {
+        auto const written = removed_.size();
+        if (written > 0) {
+            sink_(std::span<item_type const>{removed_});
+            removed_.clear();
+        }
+        return written;
+    }
+
+    /* Writes up to batch_size dirty entries and returns how many reached the sink, the cache must be locked. */
+    std::size_t
+    flush_batch()
+    {
+        batch_.clear();
+        for (auto it = dirty_.begin(); (it != dirty_.end()) && (batch_.size() < batch_size_);) {
+            auto const current = it++;
+            if (auto* value = cache_.peek(*current); value != nullptr) {
+                batch_.emplace_back(*current, *value);
+                dirty_.erase(current);
+                continue;
+            }
+            /* The entry has expired but is still cached: dropping it passes it to removed(), which writes it with
+             * the removed entries. A key that is no longer cached has no value left to write. */
+            Key const key = *current;
+            cache_.touch(key);
+            dirty_.erase(key);
+        }
+        if (!batch_.empty()) {
+            sink_(std::span<item_type const>{batch_});
+        }
+        return batch_.size() + write_removed();
+    }
+
+    void
+    flush_loop()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        for (;;) {
+            flushing_.wait(lock, [this]() { return stop_ || (dirty_.size() > max_dirty_); });
+            while (!stop_ && (dirty_.size() > max_dirty_ / 2)) {
+                flush_batch();
+                /* Let waiting readers and writers in between two batches. */
+                lock.unlock();
+                lock.lock();
+            }
+            if (stop_) {
+                return;
+            }
+        }
+    }
+};
+
+}    // namespace xitren::cache
@@ -0,0 +1,402 @@
+#include <xitren/cache/clock_cache.hpp>
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+#include <xitren/cache/static_lru.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+static constexpr std::size_t cache_size     = 16'384;
+static constexpr std::size_t ops_per_thread = 500'000;
+static constexpr std::size_t sample_every   = 8;
+
+using trace_type = std::vector<std::uint64_t>;
+
+/* Live heap bytes, kept by the replaced global operator new and delete below (plain and aligned), to measure bytes
+ * per entry. */
+static std::atomic<std::size_t> live_bytes{};
+
+[[gnu::noinline]] void*
+operator new(std::size_t size)
+{
+    auto* block = static_cast<std::size_t*>(std::malloc(size + sizeof(std::max_align_t)));
+    if (block == nullptr) {
+        throw std::bad_alloc{};
+    }
+    *block = size;
+    live_bytes.fetch_add(size, std::memory_order_relaxed);
+    return reinterpret_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+[[gnu::noinline]] void
+operator delete(void* pointer) noexcept
+{
+    if (pointer == nullptr) {
+        return;
+    }
+    /* The size header sits in front of the pointer that operator new returned */
+    std::size_t size;
+    void*       block = static_cast<char*>(pointer) - sizeof(std::max_align_t);
+    std::memcpy(&size, block, sizeof(size));
+    live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    std::free(block);
+}
+
+void
+operator delete(void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+/* Over-aligned types (e.g. the alignas(64) shards of sharded_lru) come here; the header takes a whole alignment. */
+static constexpr std::size_t
+aligned_header(std::align_val_t align) noexcept
+{
+    return std::max(static_cast<std::size_t>(align), sizeof(std::max_align_t));
+}
+
+[[gnu::noinline]] void*
+operator new(std::size_t size, std::align_val_t align)
+{
+    auto const header = aligned_header(align);
+    auto const total  = (header + size + header - 1) / header * header;
+    auto*      block  = static_cast<char*>(std::aligned_alloc(header, total));
+    if (block == nullptr) {
+        throw std::bad_alloc{};
+    }
+    std::memcpy(block, &size, sizeof(size));
+    live_bytes.fetch_add(size, std::memory_order_relaxed);
+    return block + header;
+}
+
+[[gnu::noinline]] void
+operator delete(void* pointer, std::align_val_t align) noexcept
+{
+    if (pointer == nullptr) {
+        return;
+    }
+    std::size_t size;
+    char*       block = static_cast<char*>(pointer) - aligned_header(align);
+    std::memcpy(&size, block, sizeof(size));
+    live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    std::free(block);
+}
+
+void
+operator delete(void* pointer, std::size_t, std::align_val_t align) noexcept
+{
+    operator delete(pointer, align);
+}
+
+/* Single-threaded caches are shared between threads the way callers have to: behind one mutex. */
+template <class Cache>
+class locked {
+public:
+    locked() : cache_{1h} {}
+
+    bool
+    get(std::uint64_t key)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return cache_.get(key).has_value();
+    }
+
+    void
+    put(std::uint64_t key, std::uint64_t value)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        cache_.put(key, value);
+    }
+
+    std::size_t
+    size()
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return cache_.size();
+    }
+
+private:
+    Cache      cache_;
+    std::mutex access_{};
+};
+
+template <class Cache>
+class direct {
+public:
+    direct() : cache_{1h} {}
+
+    bool
+    get(std::uint64_t key)
+    {
+        return cache_.get(key).has_value();
+    }
+
+    void
+    put(std::uint64_t key, std::uint64_t value)
+    {
+        cache_.put(key, value);
+    }
+
+    std::size_t
+    size()
+    {
+        return cache_.size();
+    }
+
+private:
+    Cache cache_;
+};
+
+/* Zipf(skew) ranks drawn by inverting a precomputed CDF. */
+class zipf_generator {
+public:
+    zipf_generator(std::size_t range, double skew) : cdf_(range)
+    {
+        double sum{};
+        for (std::size_t i{}; i < range; i++) {
+            sum += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+            cdf_[i] = sum;
+        }
+        uniform_ = std::uniform_real_distribution<double>{0.0, sum};
+    }
+
+    std::uint64_t
+    operator()(std::mt19937_64& gen)
+    {
+        return static_cast<std::uint64_t>(std::lower_bound(cdf_.begin(), cdf_.end(), uniform_(gen)) - cdf_.begin());
+    }
+
+private:
+    std::vector<double>                    cdf_;
+    std::uniform_real_distribution<double> uniform_{};
+};
+
+enum class workload { uniform, zipf, scan_mixed, replay };
+
+char const*
+workload_name(workload kind)
+{
+    switch (kind) {
+    case workload::uniform:
+        return "uniform";
+    case workload::zipf:
+        return "zipf 0.99";
+    case workload::scan_mixed:
+        return "zipf + scans";
+    default:
+        return "trace";
+    }
+}
+
+/*
+ * Uniform keys over twice the capacity; Zipf(0.99) over 16 times the capacity; and the same Zipf trace interrupted
+ * every 100k accesses by a sequential scan of 4 times the capacity, which flushes a plain LRU. Every thread gets its
+ * own sequence, from its own seed.
+ */
+trace_type
+synthetic_trace(workload kind, unsigned seed)
+{
+    std::mt19937_64 gen{seed};
+    trace_type      trace;
+    trace.reserve(ops_per_thread);
+    if (kind == workload::uniform) {
+        std::uniform_int_distribution<std::uint64_t> keys{0, cache_size * 2 - 1};
+        while (trace.size() < ops_per_thread) {
+            trace.push_back(keys(gen));
+        }
+        return trace;
+    }
+    static zipf_generator zipf{cache_size * 16, 0.99};
+    std::uint64_t         scan_key = cache_size * 16 + seed * ops_per_thread;
+    while (trace.size() < ops_per_thread) {
+        if ((kind == workload::scan_mixed) && ((trace.size() % 100'000) == 99'999)) {
+            for (std::size_t i{}; (i < cache_size * 4) && (trace.size() < ops_per_thread); i++) {
+                trace.push_back(scan_key++);
+            }
+        }
+        trace.push_back(zipf(gen));
+    }
+    return trace;
+}
+
+/* One key per line, as printed by any access log post-processing. */
+trace_type
+load_trace(char const* path)
+{
+    trace_type    trace;
+    std::ifstream file{path};
+    std::uint64_t key;
+    while (file >> key) {
+        trace.push_back(key);
+    }
+    return trace;
+}
+
+struct result_type {
+    double      ops{};
+    double      hit_ratio{};
+    double      p50{};
+    double      p99{};
+    std::size_t bytes_per_entry{};
+};
+
+/* Heap bytes of an empty cache filled to capacity, plus the cache object itself, per cached entry. */
+template <class Cache>
+std::size_t
+bytes_per_entry()
+{
+    auto const before = live_bytes.load();
+    auto       cache  = std::make_unique<Cache>();
+    for (std::uint64_t key{}; key < cache_size; key++) {
+        cache->put(key, key);
+    }
+    return (live_bytes.load() - before) / std::max<std::size_t>(1, cache->size());
+}
+
+/*
+ * Every thread replays its trace as a read-through client: get, and put on a miss. Every sample_every-th access is
+ * timed on its own for the latency percentiles; the throughput is measured over the whole run.
+ */
+template <class Cache>
+result_type
+run(std::vector<trace_type> const& traces)
+{
+    auto                             cache = std::make_unique<Cache>();
+    std::atomic<bool>                start{false};
+    std::atomic<std::size_t>         hits{};
+    std::vector<std::vector<double>> latencies(traces.size());
+    std::vector<std::thread>         workers;
+    workers.reserve(traces.size());
+    for (std::size_t t{}; t < traces.size(); t++) {
+        workers.emplace_back([&, t]() {
+            auto&       samples = latencies[t];
+            std::size_t local_hits{};
+            samples.reserve(traces[t].size() / sample_every + 1);
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (std::size_t i{}; i < traces[t].size(); i++) {
+                auto const key   = traces[t][i];
+                bool const timed = (i % sample_every) == 0;
+                auto const begin = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+                bool const hit   = cache->get(key);
+                if (!hit) {
+                    cache->put(key, key);
+                }
+                if (timed) {
+                    std::chrono::duration<double, std::nano> const elapsed = std::chrono::steady_clock::now() - begin;
+                    samples.push_back(elapsed.count());
+                }
+                local_hits += hit;
+            }
+            hits += local_hits;
+        });
+    }
+    auto const begin = std::chrono::steady_clock::now();
+    start            = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - begin;
+
+    std::size_t         total{};
+    std::vector<double> merged;
+    for (std::size_t t{}; t < traces.size(); t++) {
+        total += traces[t].size();
+        merged.insert(merged.end(), latencies[t].begin(), latencies[t].end());
+    }
+    auto percentile = [&merged](double rank) {
+        auto const nth = merged.begin() + static_cast<std::ptrdiff_t>(rank * static_cast<double>(merged.size() - 1));
+        std::nth_element(merged.begin(), nth, merged.end());
+        return *nth;
+    };
+    result_type result;
+    result.ops             = static_cast<double>(total) / elapsed.count();
+    result.hit_ratio       = static_cast<double>(hits) / static_cast<double>(total);
+    result.p50             = percentile(0.50);
+    result.p99             = percentile(0.99);
+    result.bytes_per_entry = bytes_per_entry<Cache>();
+    return result;
+}
+
+template <class Cache>
+void
+report(char const* name, std::vector<trace_type> const& traces)
+{
+    auto const result = run<Cache>(traces);
+    int const  offset = 14;
+    std::cout << std::setw(offset + 6) << name << std::setw(offset - 6) << traces.size() << std::setw(offset)
+              << std::fixed << std::setprecision(2) << result.ops / 1e6 << std::setw(offset) << std::setprecision(1)
+              << result.p50 << std::setw(offset) << result.p99 << std::setw(offset) << std::setprecision(2)
+              << 100.0 * result.hit_ratio << std::setw(offset) << result.bytes_per_entry << "\n";
+}
+
+using lru_type         = lru<std::uint64_t, std::uint64_t, cache_size, false>;
+using static_lru_type  = static_lru<std::uint64_t, std::uint64_t, cache_size, false>;
+using sharded_lru_type = sharded_lru<std::uint64_t, std::uint64_t, cache_size, 16, false>;
+using clock_cache_type = clock_cache<std::uint64_t, std::uint64_t, cache_size, false>;
+
+int
+main(int argc, char const* argv[])
+{
+    auto const     recorded    = (argc > 1) ? load_trace(argv[1]) : trace_type{};
+    unsigned const max_threads = std::max(4U, std::thread::hardware_concurrency());
+    std::cout << "Cache size " << cache_size << ", " << ops_per_thread << " accesses per thread";
+    if (!recorded.empty()) {
+        std::cout << ", trace " << argv[1] << " of " << recorded.size() << " accesses";
+    }
+    std::cout << "\n";
+
+    std::vector<workload> workloads{workload::uniform, workload::zipf, workload::scan_mixed};
+    if (!recorded.empty()) {
+        workloads.push_back(workload::replay);
+    }
+    for (auto const kind : workloads) {
+        int const offset = 14;
+        std::cout << "\nWorkload: " << workload_name(kind) << "\n"
+                  << std::setw(offset + 6) << "Cache" << std::setw(offset - 6) << "Threads" << std::setw(offset)
+                  << "Mops/sec" << std::setw(offset) << "p50 (ns)" << std::setw(offset) << "p99 (ns)"
+                  << std::setw(offset) << "Hit ratio (%)" << std::setw(offset) << "Bytes/entry\n";
+        for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+            std::vector<trace_type> traces;
+            for (unsigned t{}; t < threads; t++) {
+                if (kind != workload::replay) {
+                    traces.push_back(synthetic_trace(kind, t + 1));
+                    continue;
+                }
+                /* Threads replay the recorded trace from evenly spread starting points. */
+                auto const first = static_cast<std::ptrdiff_t>(recorded.size() * t / threads);
+                trace_type rotated(recorded.begin() + first, recorded.end());
+                rotated.insert(rotated.end(), recorded.begin(), recorded.begin() + first);
+                traces.push_back(std::move(rotated));
+            }
+            if (threads == 1) {
+                report<direct<lru_type>>("lru", traces);
+                report<direct<static_lru_type>>("static_lru", traces);
+            }
+            report<locked<lru_type>>("lru + mutex", traces);
+            report<locked<static_lru_type>>("static_lru + mutex", traces);
+            report<direct<sharded_lru_type>>("sharded_lru<16>", traces);
+            report<direct<clock_cache_type>>("clock_cache", traces);
+        }
+    }
+    return 0;
+}
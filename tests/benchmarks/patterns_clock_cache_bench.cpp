@@ -0,0 +1,87 @@
+#include <xitren/cache/clock_cache.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+static constexpr std::size_t cache_size      = 65'536;
+static constexpr int         key_range       = 65'536;
+static constexpr int         gets_per_thread = 1'000'000;
+
+/*
+ * Readers only: every thread gets random keys that are all present, nothing is put while they run. A sharded_lru of
+ * one shard is the locked lru: every get moves the entry to the front under one mutex.
+ */
+template <class Cache>
+double
+get_throughput(Cache& cache, unsigned threads)
+{
+    std::atomic<bool>        start{false};
+    std::atomic<std::size_t> hits{};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned t{}; t < threads; t++) {
+        workers.emplace_back([&cache, &start, &hits, t]() {
+            std::mt19937                  gen{t};
+            std::uniform_int_distribution keys{0, key_range - 1};
+            std::size_t                   local_hits{};
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (int i{}; i < gets_per_thread; i++) {
+                local_hits += cache.get(keys(gen)).has_value();
+            }
+            hits += local_hits;
+        });
+    }
+    auto const begin = std::chrono::steady_clock::now();
+    start            = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - begin;
+    return static_cast<double>(threads) * gets_per_thread / elapsed.count();
+}
+
+template <class Cache, class Make>
+void
+run(char const* name, unsigned threads, Make make)
+{
+    auto cache = std::make_unique<Cache>(1h);
+    for (int i{}; i < key_range; i++) {
+        cache->put(i, make(i));
+    }
+    auto const ops = get_throughput(*cache, threads);
+
+    int const offset = 20;
+    std::cout << std::setw(offset) << name << std::setw(offset) << threads << std::setw(offset) << std::fixed
+              << std::setprecision(2) << ops / 1e6 << "\n";
+}
+
+int
+main()
+{
+    auto const number = [](int i) { return static_cast<std::uint64_t>(i); };
+    auto const text   = [](int i) { return std::to_string(i); };
+
+    int const offset = 20;
+    std::cout << std::setw(offset) << "Cache" << std::setw(offset) << "Threads" << std::setw(offset)
+              << "Mops/sec (get)\n";
+    for (unsigned threads = 1; threads <= 32; threads *= 2) {
+        run<sharded_lru<int, std::uint64_t, cache_size, 1, false>>("lru", threads, number);
+        run<clock_cache<int, std::uint64_t, cache_size, false>>("clock (lock-free)", threads, number);
+        run<clock_cache<int, std::string, cache_size, false>>("clock (shared lock)", threads, text);
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+static constexpr std::size_t cache_size    = 262'144;
+static constexpr std::size_t lookups       = 4'194'304;
+static constexpr int         key_range     = 2 * cache_size;
+static constexpr std::size_t batch_sizes[] = {64, 256, 512};
+
+using cache_type = sharded_lru<std::string, std::uint64_t, cache_size, 16, false>;
+
+std::vector<std::string>
+make_keys(std::size_t count)
+{
+    std::mt19937                  gen{1};
+    std::uniform_int_distribution keys{0, key_range - 1};
+    std::vector<std::string>      result;
+    result.reserve(count);
+    for (std::size_t i{}; i < count; i++) {
+        result.push_back("session:" + std::to_string(keys(gen)));
+    }
+    return result;
+}
+
+template <class Func>
+double
+measure(Func&& func)
+{
+    auto const begin = std::chrono::steady_clock::now();
+    func();
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - begin;
+    return static_cast<double>(lookups) / elapsed.count();
+}
+
+int
+main()
+{
+    cache_type cache{1h};
+    for (int i{}; i < key_range; i += 2) {
+        cache.put("session:" + std::to_string(i), static_cast<std::uint64_t>(i));
+    }
+    auto const keys = make_keys(lookups);
+
+    int const offset = 20;
+    std::cout << std::setw(offset) << "Batch" << std::setw(offset) << "Mops/sec (get)" << std::setw(offset)
+              << "Mops/sec (batch)\n";
+    for (auto const batch : batch_sizes) {
+        std::size_t single_hits{};
+        std::size_t batch_hits{};
+        auto const  single = measure([&]() {
+            for (auto const& key : keys) {
+                single_hits += cache.get(key).has_value();
+            }
+        });
+        auto const  many   = measure([&]() {
+            for (std::size_t first{}; first < keys.size(); first += batch) {
+                for (auto const& item : cache.get_many(std::span{keys}.subspan(first, batch))) {
+                    batch_hits += item.has_value();
+                }
+            }
+        });
+        if (single_hits != batch_hits) {
+            std::cerr << "Hit counts differ: " << single_hits << " vs " << batch_hits << "\n";
+            return 1;
+        }
+        std::cout << std::setw(offset) << batch << std::setw(offset) << std::fixed << std::setprecision(2)
+                  << single / 1e6 << std::setw(offset) << many / 1e6 << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/policies/arc_policy.hpp>
+#include <xitren/cache/policies/tiny_lfu_policy.hpp>
+#include <xitren/cache/policies/two_queue_policy.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+static constexpr std::size_t cache_size = 4'096;
+
+using trace_type = std::vector<std::uint64_t>;
+
+/* Zipf(0.99) over a key range, interrupted every 100k accesses by a sequential scan of cache_size * 4 keys. */
+trace_type
+synthetic_trace()
+{
+    constexpr std::size_t key_range = cache_size * 16;
+    constexpr std::size_t length    = 1'000'000;
+    constexpr double      skew      = 0.99;
+
+    std::vector<double> cdf(key_range);
+    double              sum{};
+    for (std::size_t i{}; i < key_range; i++) {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+        cdf[i] = sum;
+    }
+    std::mt19937_64                        gen{1};
+    std::uniform_real_distribution<double> uniform{0.0, sum};
+    trace_type                             trace;
+    trace.reserve(length);
+    std::uint64_t scan_key = key_range;
+    while (trace.size() < length) {
+        if ((trace.size() % 100'000) == 99'999) {
+            for (std::size_t i{}; i < cache_size * 4; i++) {
+                trace.push_back(scan_key++);
+            }
+        }
+        auto const rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(gen)) - cdf.begin();
+        trace.push_back(static_cast<std::uint64_t>(rank));
+    }
+    return trace;
+}
+
+/* One key per line, as printed by any access log post-processing. */
+trace_type
+load_trace(char const* path)
+{
+    trace_type    trace;
+    std::ifstream file{path};
+    std::uint64_t key;
+    while (file >> key) {
+        trace.push_back(key);
+    }
+    return trace;
+}
+
+template <template <class, std::size_t> class Policy>
+void
+replay(std::string const& name, trace_type const& trace)
+{
+    lru<std::uint64_t, std::uint64_t, cache_size, false, Policy> cache{1h};
+    std::size_t                                                  hits{};
+    auto const                                                   begin = std::chrono::steady_clock::now();
+    for (auto const key : trace) {
+        if (cache.get(key)) {
+            hits++;
+        } else {
+            cache.put(key, key);
+        }
+    }
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - begin;
+
+    int const offset = 20;
+    std::cout << std::setw(offset) << name << std::setw(offset) << std::fixed << std::setprecision(2)
+              << 100.0 * static_cast<double>(hits) / static_cast<double>(trace.size()) << std::setw(offset)
+              << static_cast<double>(trace.size()) / elapsed.count() / 1e6 << "\n";
+}
+
+int
+main(int argc, char const* argv[])
+{
+    auto const trace = (argc > 1) ? load_trace(argv[1]) : synthetic_trace();
+    std::cout << "Trace: " << ((argc > 1) ? argv[1] : "synthetic zipf + scans") << ", " << trace.size()
+              << " accesses, cache size " << cache_size << "\n";
+
+    int const offset = 20;
+    std::cout << std::setw(offset) << "Policy" << std::setw(offset) << "Hit ratio (%)" << std::setw(offset)
+              << "Mops/sec\n";
+    replay<lru_policy>("LRU", trace);
+    replay<two_queue_policy>("2Q", trace);
+    replay<arc_policy>("ARC", trace);
+    replay<tiny_lfu_policy>("W-TinyLFU", trace);
+    return 0;
+}
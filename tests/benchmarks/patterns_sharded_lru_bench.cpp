@@ -0,0 +1,77 @@
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+static constexpr std::size_t cache_size      = 65'536;
+static constexpr int         key_range       = 65'536;
+static constexpr int         gets_per_thread = 1'000'000;
+
+template <class Cache>
+double
+get_throughput(Cache& cache, unsigned threads, std::atomic<std::size_t>& hits)
+{
+    std::atomic<bool>        start{false};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned t{}; t < threads; t++) {
+        workers.emplace_back([&cache, &start, &hits, t]() {
+            std::mt19937                  gen{t};
+            std::uniform_int_distribution keys{0, key_range - 1};
+            std::size_t                   local_hits{};
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (int i{}; i < gets_per_thread; i++) {
+                local_hits += cache.get(keys(gen)).has_value();
+            }
+            hits += local_hits;
+        });
+    }
+    auto const begin = std::chrono::steady_clock::now();
+    start            = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - begin;
+    return static_cast<double>(threads) * gets_per_thread / elapsed.count();
+}
+
+template <std::size_t Shards>
+void
+run(unsigned threads)
+{
+    sharded_lru<int, std::uint64_t, cache_size, Shards, false> cache{1h};
+    for (int i{}; i < key_range; i++) {
+        cache.put(i, static_cast<std::uint64_t>(i));
+    }
+    std::atomic<std::size_t> hits{};
+    auto const               ops = get_throughput(cache, threads, hits);
+
+    int const offset = 20;
+    std::cout << std::setw(offset) << Shards << std::setw(offset) << threads << std::setw(offset) << std::fixed
+              << std::setprecision(2) << ops / 1e6 << std::setw(offset)
+              << 100.0 * static_cast<double>(hits) / (static_cast<double>(threads) * gets_per_thread) << "\n";
+}
+
+int
+main()
+{
+    int const offset = 20;
+    std::cout << std::setw(offset) << "Shards" << std::setw(offset) << "Threads" << std::setw(offset)
+              << "Mops/sec (get)" << std::setw(offset) << "Hit ratio (%)\n";
+    for (unsigned threads = 1; threads <= 32; threads *= 2) {
+        run<1>(threads);
+        run<64>(threads);
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include <xitren/allocators/concurrent_heap.hpp>
+#include <xitren/allocators/static_heap.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace xitren::allocators;
+
+static constexpr std::size_t heap_size = 4 * 1024 * 1024;
+static constexpr int         rounds    = 10;
+
+/*
+ * Fills the heap with count small blocks of random sizes, then repeatedly frees a random half of them and allocates
+ * it again, which is where a first fit free list has to be walked. Returns nanoseconds per allocate + deallocate.
+ */
+template <heap_mode Mode>
+double
+churn(std::size_t count)
+{
+    auto                                       manager = std::make_unique<static_heap<heap_size, Mode>>();
+    std::mt19937                               gen{1};
+    std::uniform_int_distribution<std::size_t> sizes{16, 256};
+    std::vector<void*>                         blocks(count);
+    std::vector<std::size_t>                   order(count);
+    for (std::size_t i{}; i < count; i++) {
+        blocks[i] = manager->allocate(sizes(gen));
+        order[i]  = i;
+    }
+
+    auto const begin = std::chrono::steady_clock::now();
+    for (int round{}; round < rounds; round++) {
+        std::shuffle(order.begin(), order.end(), gen);
+        for (std::size_t i{}; i < count / 2; i++) {
+            manager->deallocate(blocks[order[i]]);
+        }
+        for (std::size_t i{}; i < count / 2; i++) {
+            blocks[order[i]] = manager->allocate(sizes(gen));
+        }
+    }
+    std::chrono::duration<double, std::nano> const elapsed = std::chrono::steady_clock::now() - begin;
+    return elapsed.count() / static_cast<double>(rounds * (count / 2));
+}
+
+/* The baseline for concurrent_heap: a static_heap behind one lock. */
+template <heap_mode Mode>
+class locked_heap {
+public:
+    void*
+    allocate(std::size_t size)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        return heap_.allocate(size);
+    }
+
+    void
+    deallocate(void* pointer, std::size_t)
+    {
+        std::unique_lock<std::mutex> lock(access_);
+        heap_.deallocate(pointer);
+    }
+
+private:
+    static_heap<heap_size, Mode> heap_{};
+    std::mutex                   access_{};
+};
+
+/* Every thread keeps 64 small blocks live and replaces one of them per step. Returns total Mops/sec. */
+template <class Heap>
+double
+parallel_churn(unsigned threads)
+{
+    constexpr std::size_t    steps   = 200'000;
+    auto                     manager = std::make_unique<Heap>();
+    std::vector<std::thread> workers;
+    auto const               begin = std::chrono::steady_clock::now();
+    for (unsigned t{}; t < threads; t++) {
+        workers.emplace_back([&manager, t]() {
+            std::mt19937                               gen{t};
+            std::uniform_int_distribution<std::size_t> sizes{8, 128};
+            std::vector<std::pair<void*, std::size_t>> live(64);
+            for (auto& [block, size] : live) {
+                size  = sizes(gen);
+                block = manager->allocate(size);
+            }
+            for (std::size_t i{}; i < steps; i++) {
+                auto& [block, size] = live[i % live.size()];
+                manager->deallocate(block, size);
+                size  = sizes(gen);
+                block = manager->allocate(size);
+            }
+            for (auto [block, size] : live) {
+                manager->deallocate(block, size);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - begin;
+    return static_cast<double>(threads * steps) / elapsed.count() / 1e6;
+}
+
+int
+main()
+{
+    int const offset = 20;
+    std::cout << std::setw(offset) << "Blocks" << std::setw(offset) << "first_fit (ns)" << std::setw(offset)
+              << "tlsf (ns)\n";
+    for (std::size_t count = 256; count <= 16'384; count *= 4) {
+        std::cout << std::setw(offset) << count << std::setw(offset) << std::fixed << std::setprecision(1)
+                  << churn<heap_mode::first_fit>(count) << std::setw(offset) << churn<heap_mode::tlsf>(count)
+                  << "\n";
+    }
+
+    std::cout << "\n"
+              << std::setw(offset) << "Threads" << std::setw(offset) << "locked Mops/sec" << std::setw(offset)
+              << "concurrent Mops/sec\n";
+    for (unsigned threads = 1; threads <= std::max(4U, std::thread::hardware_concurrency()); threads *= 2) {
+        std::cout << std::setw(offset) << threads << std::setw(offset) << std::fixed << std::setprecision(2)
+                  << parallel_churn<locked_heap<heap_mode::tlsf>>(threads) << std::setw(offset)
+                  << parallel_churn<concurrent_heap<heap_size, heap_mode::tlsf>>(threads) << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <xitren/cache/clock_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+TEST(clock_cache_test, simple_check)
+{
+    clock_cache<int, std::string, 8, false> inst{1s};
+    inst.put(11, "First data");
+    auto item = inst.get(11);
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::get<1>(*item), "First data");
+    EXPECT_FALSE(inst.get(12).has_value());
+    inst.put(11, "Second data");
+    EXPECT_EQ(std::get<1>(*inst.get(11)), "Second data");
+    EXPECT_EQ(inst.size(), 1);
+}
+
+TEST(clock_cache_test, referenced_entries_get_second_chance)
+{
+    clock_cache<int, int, 4, false> inst{1s};
+    for (int i = 0; i < 4; i++) {
+        inst.put(i, i * 10);
+    }
+    EXPECT_TRUE(inst.get(0).has_value());
+    EXPECT_TRUE(inst.touch(2));
+    inst.put(4, 40);
+    inst.put(5, 50);
+    EXPECT_EQ(inst.size(), 4);
+    EXPECT_TRUE(inst.get(0).has_value());
+    EXPECT_FALSE(inst.get(1).has_value());
+    EXPECT_TRUE(inst.get(2).has_value());
+    EXPECT_FALSE(inst.get(3).has_value());
+    EXPECT_TRUE(inst.get(4).has_value());
+    EXPECT_TRUE(inst.get(5).has_value());
+}
+
+TEST(clock_cache_test, expired_items)
+{
+    clock_cache<int, int, 4, true> inst{10ms};
+    inst.put(1, 1);
+    EXPECT_NO_THROW({ inst.get(1); });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_THROW({ inst.get(1); }, cache_timeout);
+}
+
+TEST(clock_cache_test, concurrent_readers)
+{
+    clock_cache<int, int, 256, false> inst{1h};
+    for (int i = 0; i < 256; i++) {
+        inst.put(i, i);
+    }
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 8; t++) {
+        workers.emplace_back([&inst, t]() {
+            for (int i = 0; i < 10'000; i++) {
+                auto const key = (i + t) % 512;
+                if (t == 0 && (i % 16) == 0) {
+                    inst.put(key, key);
+                } else if (auto item = inst.get(key); item) {
+                    EXPECT_EQ(std::get<1>(*item), key);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(inst.size(), 256);
+}
+
+template <class Value>
+void
+expect_consistent_reads(Value (*make)(std::uint64_t), bool (*valid)(std::uint64_t, Value const&))
+{
+    clock_cache<std::uint64_t, Value, 64, false> inst{1h};
+    std::atomic<bool>                            done{false};
+    std::atomic<int>                             torn{};
+    std::vector<std::thread>                     readers;
+    for (int t = 0; t < 4; t++) {
+        readers.emplace_back([&]() {
+            for (std::uint64_t key{}; !done; key = (key + 1) % 128) {
+                if (auto item = inst.get(key); item && !valid(key, std::get<1>(*item))) {
+                    torn++;
+                }
+                inst.touch(key);
+            }
+        });
+    }
+    for (std::uint64_t i{}; i < 50'000; i++) {
+        auto const key = (i * 7) % 128;
+        inst.put(key, make(key + i * 128));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(torn, 0);
+}
+
+TEST(clock_cache_test, optimistic_reads_are_never_torn)
+{
+    /* Each value encodes its key, so a copy mixing two writes is caught. */
+    expect_consistent_reads<std::uint64_t>([](std::uint64_t seed) { return seed; },
+                                           [](std::uint64_t key, std::uint64_t const& value) {
+                                               return (value % 128) == key;
+                                           });
+    using wide = std::array<std::uint64_t, 5>;
+    expect_consistent_reads<wide>([](std::uint64_t seed) { return wide{seed, seed, seed, seed, seed}; },
+                                  [](std::uint64_t key, wide const& value) {
+                                      return ((value[0] % 128) == key)
+                                             && (value == wide{value[0], value[0], value[0], value[0], value[0]});
+                                  });
+}
@@ -0,0 +1,166 @@
+#include <xitren/allocators/concurrent_heap.hpp>
+#include <xitren/allocators/static_heap_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace xitren::allocators;
+
+TEST(TestConcurrentHeap, CachesFreedBlocks)
+{
+    auto       manager = std::make_unique<concurrent_heap<16384>>();
+    auto const initial = manager->free_heap_size();
+
+    auto* ptr1 = manager->allocate(24);
+    ASSERT_NE(ptr1, nullptr);
+    /* A whole batch was taken from the heap for the 32 byte class. */
+    auto const after_refill = manager->free_heap_size();
+    EXPECT_LT(after_refill, initial);
+    auto* ptr2 = manager->allocate(30);
+    EXPECT_EQ(manager->free_heap_size(), after_refill);
+
+    manager->deallocate(ptr2, 30);
+    EXPECT_EQ(manager->allocate(17), ptr2);
+    manager->deallocate(ptr2, 17);
+    manager->deallocate(ptr1, 24);
+    EXPECT_EQ(manager->free_heap_size(), after_refill);
+
+    manager->flush();
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
+
+TEST(TestConcurrentHeap, LargeBlocksBypassMagazines)
+{
+    auto       manager = std::make_unique<concurrent_heap<16384, heap_mode::tlsf>>();
+    auto const initial = manager->free_heap_size();
+    auto*      ptr     = manager->allocate(1000);
+    ASSERT_NE(ptr, nullptr);
+    manager->deallocate(ptr, 1000);
+    EXPECT_EQ(manager->free_heap_size(), initial);
+
+    int failures{};
+    manager->on_fail([&failures]() { failures++; });
+    EXPECT_EQ(manager->allocate(32768), nullptr);
+    EXPECT_EQ(failures, 1);
+}
+
+template <class Heap>
+void
+hammer(Heap& manager, unsigned threads)
+{
+    std::vector<std::thread> workers;
+    std::atomic<int>         corrupted{};
+    for (unsigned t{}; t < threads; t++) {
+        workers.emplace_back([&manager, &corrupted, t]() {
+            std::mt19937                                       gen{t};
+            std::uniform_int_distribution<std::size_t>         sizes{1, 300};
+            std::vector<std::pair<std::uint8_t*, std::size_t>> live;
+            for (int i = 0; i < 20'000; i++) {
+                if (live.empty() || ((gen() % 2) == 0)) {
+                    auto const size = sizes(gen);
+                    auto*      ptr  = static_cast<std::uint8_t*>(manager.allocate(size));
+                    if (ptr != nullptr) {
+                        std::memset(ptr, static_cast<int>(t), size);
+                        live.emplace_back(ptr, size);
+                    }
+                    continue;
+                }
+                auto const victim = gen() % live.size();
+                auto [ptr, size]  = live[victim];
+                if (!std::all_of(ptr, ptr + size, [t](std::uint8_t byte) { return byte == t; })) {
+                    corrupted++;
+                }
+                manager.deallocate(ptr, size);
+                live[victim] = live.back();
+                live.pop_back();
+            }
+            for (auto [ptr, size] : live) {
+                manager.deallocate(ptr, size);
+            }
+            manager.flush();
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(corrupted, 0);
+}
+
+TEST(TestConcurrentHeap, ThreadsShareTheHeap)
+{
+    auto       manager = std::make_unique<concurrent_heap<1 << 20, heap_mode::tlsf>>();
+    auto const initial = manager->free_heap_size();
+    hammer(*manager, 8);
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
+
+TEST(TestConcurrentHeap, MoreThreadsThanCaches)
+{
+    auto       manager = std::make_unique<concurrent_heap<1 << 20, heap_mode::first_fit, 2>>();
+    auto const initial = manager->free_heap_size();
+    hammer(*manager, 4);
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
+
+TEST(TestConcurrentHeap, UncachedBlockFreedIntoMagazine)
+{
+    auto       manager = std::make_unique<concurrent_heap<4096, heap_mode::first_fit, 1>>();
+    auto const initial = manager->free_heap_size();
+    /* The main thread takes the only cache, the worker gets none. */
+    manager->flush();
+
+    void* ptr{};
+    void* next{};
+    std::thread{[&]() {
+        ptr  = manager->allocate(20);
+        next = manager->allocate(20);
+    }}.join();
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_NE(next, nullptr);
+    std::memset(next, 0x5a, 20);
+
+    /* The sized free caches the block in the 32 byte class, so it must hold 32 bytes. */
+    manager->deallocate(ptr, 20);
+    auto* reused = manager->allocate(32);
+    EXPECT_EQ(reused, ptr);
+    std::memset(reused, 0xcd, 32);
+    auto const* bytes = static_cast<std::uint8_t const*>(next);
+    EXPECT_TRUE(std::all_of(bytes, bytes + 20, [](std::uint8_t byte) { return byte == 0x5a; }));
+
+    manager->deallocate(reused, 32);
+    manager->deallocate(next);
+    manager->flush();
+    EXPECT_EQ(manager->free_heap_size(), initial);
+    heap_stats stats{};
+    manager->v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 1);
+}
+
+TEST(TestConcurrentHeap, Allocator)
+{
+    constexpr std::size_t               val     = 65536;
+    auto                                manager = std::make_unique<concurrent_heap<val>>();
+    concurrent_heap_allocator<int, val> alloc{*manager};
+    std::vector<std::thread>            workers;
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&alloc]() {
+            std::list<int, concurrent_heap_allocator<int, val>> list{alloc};
+            for (int i = 0; i < 500; i++) {
+                list.push_back(i);
+            }
+            EXPECT_EQ(list.back(), 499);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
@@ -0,0 +1,118 @@
+#include <xitren/allocators/concurrent_heap.hpp>
+#include <xitren/allocators/heap_resource.hpp>
+#include <xitren/allocators/profiled_heap.hpp>
+#include <xitren/allocators/static_heap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace xitren::allocators;
+
+TEST(TestHeapResource, ContainersShareOneHeap)
+{
+    using heap_t = static_heap<65536, heap_mode::tlsf>;
+
+    auto                  manager = std::make_unique<heap_t>();
+    auto const            initial = manager->free_heap_size();
+    heap_resource<heap_t> resource{*manager};
+    {
+        std::pmr::vector<int>                          numbers{&resource};
+        std::pmr::unordered_map<int, std::pmr::string> names{&resource};
+        std::pmr::vector<std::pmr::string>             words{&resource};
+        for (int i = 0; i < 100; i++) {
+            numbers.push_back(i);
+            names.emplace(i, "a name long enough to need the heap");
+        }
+        words.emplace_back("moved between containers of the same resource without a copy");
+        auto const*      text = words.back().data();
+        std::pmr::string taken{std::move(words.back()), &resource};
+        EXPECT_EQ(taken.data(), text);
+        EXPECT_EQ(names.at(42).get_allocator().resource(), &resource);
+        EXPECT_LT(manager->free_heap_size(), initial);
+    }
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
+
+TEST(TestHeapResource, Equality)
+{
+    auto                             first  = std::make_unique<static_heap<4096>>();
+    auto                             second = std::make_unique<static_heap<4096>>();
+    heap_resource<static_heap<4096>> resource1{*first};
+    heap_resource<static_heap<4096>> resource2{*first};
+    heap_resource<static_heap<4096>> resource3{*second};
+    EXPECT_TRUE(resource1.is_equal(resource2));
+    EXPECT_FALSE(resource1.is_equal(resource3));
+    EXPECT_FALSE(resource1.is_equal(*std::pmr::new_delete_resource()));
+    EXPECT_EQ(&resource1.heap(), first.get());
+}
+
+TEST(TestHeapResource, AlignmentAndExhaustion)
+{
+    auto                             manager = std::make_unique<static_heap<8192>>();
+    heap_resource<static_heap<8192>> resource{*manager};
+    std::pmr::memory_resource&       base = resource;
+
+    auto* line = base.allocate(100, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(line) % 64, 0);
+    auto* empty = base.allocate(0);
+    EXPECT_NE(empty, nullptr);
+    EXPECT_THROW(static_cast<void>(base.allocate(1 << 20)), std::bad_alloc);
+    base.deallocate(line, 100, 64);
+    base.deallocate(empty, 0);
+
+    heap_stats stats{};
+    manager->v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 1);
+}
+
+TEST(TestHeapResource, PoolInFront)
+{
+    using heap_t = profiled_heap<static_heap<1 << 20, heap_mode::tlsf>>;
+
+    auto                  manager = std::make_unique<heap_t>();
+    heap_resource<heap_t> resource{*manager};
+    {
+        std::pmr::unsynchronized_pool_resource pool{&resource};
+        std::pmr::vector<std::pmr::string>     words{&pool};
+        for (int i = 0; i < 1000; i++) {
+            words.emplace_back("pooled string that does not fit the small buffer");
+        }
+        words.clear();
+        words.shrink_to_fit();
+        /* The pool takes large chunks from the heap and carves the strings out of them. */
+        EXPECT_LT(manager->size_histogram()[heap_t::size_class_of(64)].allocations, 100);
+    }
+    EXPECT_EQ(manager->live_bytes(), 0);
+}
+
+TEST(TestHeapResource, ConcurrentHeap)
+{
+    auto                                    manager = std::make_unique<concurrent_heap<1 << 20>>();
+    heap_resource<concurrent_heap<1 << 20>> resource{*manager};
+    auto const                              initial = manager->free_heap_size();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&resource]() {
+            {
+                std::pmr::vector<std::pmr::vector<int>> lists{&resource};
+                for (int i = 0; i < 200; i++) {
+                    lists.emplace_back(static_cast<std::size_t>(i % 17 + 1), i);
+                }
+            }
+            resource.heap().flush();
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
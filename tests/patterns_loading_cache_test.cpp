@@ -0,0 +1,132 @@
+#include <xitren/cache/loading_cache.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+using cache_type = sharded_lru<int, std::string, 256, 4, false>;
+
+TEST(loading_cache_test, read_through)
+{
+    cache_type       cache{1h};
+    std::atomic<int> loads{};
+    loading_cache    inst{cache, [&loads](int key) {
+                           loads++;
+                           return std::to_string(key);
+                       }};
+    EXPECT_EQ(inst.get(1), "1");
+    EXPECT_EQ(inst.get(1), "1");
+    EXPECT_EQ(inst.get(2), "2");
+    EXPECT_EQ(loads, 2);
+    EXPECT_TRUE(cache.get(1).has_value());
+}
+
+TEST(loading_cache_test, single_flight)
+{
+    cache_type       cache{1h};
+    std::atomic<int> loads{};
+    loading_cache    inst{cache, [&loads](int key) {
+                           loads++;
+                           std::this_thread::sleep_for(50ms);
+                           return std::to_string(key);
+                       }};
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 8; i++) {
+        callers.emplace_back([&inst]() { EXPECT_EQ(inst.get(7), "7"); });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    EXPECT_EQ(loads, 1);
+    EXPECT_EQ(inst.in_flight(), 0);
+}
+
+TEST(loading_cache_test, failed_load_is_not_cached)
+{
+    cache_type       cache{1h};
+    std::atomic<int> loads{};
+    loading_cache    inst{cache, [&loads](int key) -> std::string {
+                           if (loads++ == 0) {
+                               throw std::runtime_error("backend is down");
+                           }
+                           return std::to_string(key);
+                       }};
+    EXPECT_THROW(inst.get(3), std::runtime_error);
+    EXPECT_FALSE(cache.get(3).has_value());
+    EXPECT_EQ(inst.get(3), "3");
+}
+
+TEST(loading_cache_test, refresh_ahead)
+{
+    cache_type       cache{200ms};
+    std::atomic<int> loads{};
+    loading_cache    inst{cache,
+                       [&loads](int) {
+                           std::this_thread::sleep_for(10ms);
+                           return std::to_string(loads++);
+                       },
+                       20ms};
+    EXPECT_EQ(inst.get(1), "0");
+    std::this_thread::sleep_for(30ms);
+    EXPECT_EQ(inst.get(1), "0");
+    for (int i = 0; (i < 100) && (loads < 2); i++) {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ(loads, 2);
+    for (int i = 0; (i < 100) && (inst.in_flight() > 0); i++) {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ(inst.get(1), "1");
+}
+
+TEST(loading_cache_test, queued_refreshes_fail_on_destruction)
+{
+    cache_type        cache{40ms};
+    std::atomic<bool> slow{false};
+    auto              inst = std::make_unique<loading_cache<cache_type, std::function<std::string(int)>>>(
+        cache,
+        [&slow](int key) {
+            if (slow) {
+                std::this_thread::sleep_for(100ms);
+            }
+            return std::to_string(key);
+        },
+        10ms);
+    EXPECT_EQ(inst->get(1), "1");
+    EXPECT_EQ(inst->get(2), "2");
+    std::this_thread::sleep_for(15ms);
+    slow = true;
+    /* The refresh of 1 keeps the worker busy while the refresh of 2 waits in the queue. */
+    EXPECT_EQ(inst->get(1), "1");
+    EXPECT_EQ(inst->get(2), "2");
+    EXPECT_EQ(inst->in_flight(), 2);
+    std::this_thread::sleep_for(35ms);
+
+    std::atomic<bool> calling{false};
+    std::atomic<bool> closed{false};
+    std::thread       waiter{[loader = inst.get(), &calling, &closed]() {
+        calling = true;
+        try {
+            static_cast<void>(loader->get(2));
+        } catch (cache_closed const&) {
+            closed = true;
+        }
+    }};
+    while (!calling) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(20ms);
+    inst.reset();
+    waiter.join();
+    EXPECT_TRUE(closed);
+}
@@ -3,8 +3,54 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
 
 TEST(lru_test, simple_check)
 {
+    lru<int, std::string, 8, false> inst{1s};
+    inst.put(11, "First data");
+    auto item = inst.get(11);
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::get<1>(*item), "First data");
+    EXPECT_FALSE(inst.get(12).has_value());
+}
+
+TEST(lru_test, update_existing_key)
+{
+    lru<int, std::string, 8, false> inst{1s};
+    inst.put(1, "old");
+    inst.put(1, "new");
+    EXPECT_EQ(inst.size(), 1);
+    EXPECT_EQ(std::get<1>(*inst.get(1)), "new");
+}
 
+TEST(lru_test, evicts_least_recently_used)
+{
+    lru<int, int, 4, false> inst{1s};
+    for (int i = 0; i < 4; i++) {
+        inst.put(i, i * 10);
+    }
+    EXPECT_TRUE(inst.get(0).has_value());
+    EXPECT_TRUE(inst.touch(1));
+    inst.put(4, 40);
+    inst.put(5, 50);
+    EXPECT_EQ(inst.size(), 4);
+    EXPECT_TRUE(inst.get(0).has_value());
+    EXPECT_TRUE(inst.get(1).has_value());
+    EXPECT_FALSE(inst.get(2).has_value());
+    EXPECT_FALSE(inst.get(3).has_value());
+    EXPECT_FALSE(inst.touch(3));
+}
+
+TEST(lru_test, expired_items)
+{
+    lru<int, int, 4, true> inst{10ms};
+    inst.put(1, 1);
+    EXPECT_NO_THROW({ inst.get(1); });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_THROW({ inst.get(1); }, cache_timeout);
+    EXPECT_EQ(inst.size(), 0);
 }
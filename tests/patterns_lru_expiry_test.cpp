@@ -0,0 +1,100 @@
+#include <xitren/cache/coarse_clock.hpp>
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/reaper.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+TEST(lru_expiry_test, per_entry_ttl)
+{
+    lru<int, int, 8, false> inst{1h};
+    inst.put(1, 1, 10ms);
+    inst.put(2, 2);
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(inst.get(1).has_value());
+    EXPECT_TRUE(inst.get(2).has_value());
+    EXPECT_EQ(inst.size(), 1);
+}
+
+TEST(lru_expiry_test, update_extends_ttl)
+{
+    lru<int, int, 8, false> inst{1h};
+    inst.put(1, 1, 10ms);
+    inst.put(1, 2, 1h);
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(std::get<1>(*inst.get(1)), 2);
+}
+
+TEST(lru_expiry_test, touch_drops_expired)
+{
+    lru<int, int, 8, false> inst{10ms};
+    inst.put(1, 1);
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(inst.touch(1));
+    EXPECT_EQ(inst.size(), 0);
+}
+
+TEST(lru_expiry_test, reap_in_batches)
+{
+    lru<int, int, 128, false> inst{1h};
+    for (int i = 0; i < 100; i++) {
+        inst.put(i, i, (i % 2) ? 1h : 5ms);
+    }
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(inst.reap(20), 20);
+    EXPECT_EQ(inst.size(), 80);
+    EXPECT_EQ(inst.reap(100), 30);
+    EXPECT_EQ(inst.size(), 50);
+    EXPECT_EQ(inst.reap(100), 0);
+    for (int i = 1; i < 100; i += 2) {
+        EXPECT_TRUE(inst.touch(i));
+    }
+}
+
+TEST(lru_expiry_test, evicted_entries_are_not_reaped)
+{
+    lru<int, int, 4, false> inst{5ms};
+    for (int i = 0; i < 16; i++) {
+        inst.put(i, i);
+    }
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(inst.reap(100), 4);
+    EXPECT_EQ(inst.size(), 0);
+}
+
+TEST(lru_expiry_test, coarse_clock)
+{
+    auto const before = coarse_clock::now();
+    {
+        coarse_clock::ticker ticker{1ms};
+        auto const           first = coarse_clock::now();
+        EXPECT_GE(first, before);
+        std::this_thread::sleep_for(50ms);
+        EXPECT_GT(coarse_clock::now(), first);
+    }
+    EXPECT_GE(coarse_clock::now(), before);
+
+    lru<int, int, 8, false, lru_policy, coarse_clock> inst{1h};
+    inst.put(1, 1);
+    EXPECT_TRUE(inst.get(1).has_value());
+}
+
+TEST(lru_expiry_test, background_reaper)
+{
+    sharded_lru<int, int, 256, 4, false> inst{10ms};
+    for (int i = 0; i < 200; i++) {
+        inst.put(i, i);
+    }
+    {
+        reaper cleaner{inst, 5ms, 16};
+        for (int i = 0; (i < 100) && (inst.size() > 0); i++) {
+            std::this_thread::sleep_for(10ms);
+        }
+    }
+    EXPECT_EQ(inst.size(), 0);
+}
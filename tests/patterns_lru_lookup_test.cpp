@@ -0,0 +1,137 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/policies/tiny_lfu_policy.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct pinned {
+    pinned(int first, int second) : sum{first + second} {}
+    pinned(pinned const&) = delete;
+    pinned&
+    operator=(pinned const&)
+        = delete;
+
+    int sum;
+};
+
+}    // namespace
+
+/* String keyed maps cache hash codes in their nodes, as they do with std::hash<std::string>. */
+static_assert(!std::is_nothrow_invocable_v<transparent_hash<std::string> const&, std::string const&>);
+
+TEST(lru_lookup_test, heterogeneous_lookup)
+{
+    lru<std::string, int, 8, false, tiny_lfu_policy> inst{1h};
+    inst.put("first", 1);
+    std::string_view const key{"first"};
+    auto                   item = inst.get(key);
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::get<1>(*item), 1);
+    EXPECT_TRUE(inst.touch("first"));
+    EXPECT_FALSE(inst.get(std::string_view{"second"}).has_value());
+}
+
+TEST(lru_lookup_test, emplace_and_try_emplace)
+{
+    lru<int, std::string, 8, false> inst{1h};
+    inst.emplace(1, 3, 'a');
+    EXPECT_EQ(std::get<1>(*inst.get(1)), "aaa");
+    EXPECT_FALSE(inst.try_emplace(1, "other"));
+    EXPECT_EQ(std::get<1>(*inst.get(1)), "aaa");
+    EXPECT_TRUE(inst.try_emplace(2, "other"));
+    EXPECT_EQ(std::get<1>(*inst.get(2)), "other");
+    inst.emplace(1, "replaced");
+    EXPECT_EQ(std::get<1>(*inst.get(1)), "replaced");
+}
+
+TEST(lru_lookup_test, find_without_copy)
+{
+    lru<int, pinned, 2, false> inst{1h};
+    EXPECT_TRUE(inst.try_emplace(1, 2, 3));
+    auto* value = inst.find(1);
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(value->sum, 5);
+    value->sum = 7;
+    EXPECT_EQ(inst.find(1)->sum, 7);
+    EXPECT_EQ(inst.find(2), nullptr);
+
+    lru<int, std::unique_ptr<int>, 2, false> owners{1h};
+    owners.emplace(1, std::make_unique<int>(42));
+    ASSERT_NE(owners.find(1), nullptr);
+    EXPECT_EQ(**owners.find(1), 42);
+}
+
+TEST(lru_lookup_test, sharded_visit)
+{
+    sharded_lru<std::string, std::string, 64, 4, false> inst{1h};
+    inst.emplace("key", "value");
+    EXPECT_FALSE(inst.try_emplace("key", "other"));
+    std::size_t length{};
+    EXPECT_TRUE(inst.visit(std::string_view{"key"}, [&length](std::string& value) { length = value.size(); }));
+    EXPECT_EQ(length, 5);
+    EXPECT_FALSE(inst.visit(std::string_view{"missing"}, [](std::string&) { FAIL(); }));
+    EXPECT_TRUE(inst.get(std::string_view{"key"}).has_value());
+}
+
+TEST(lru_lookup_test, batch_get_and_put)
+{
+    lru<int, int, 256, true> inst{1h};
+    std::vector<std::pair<int, int>> items;
+    for (int i = 0; i < 100; i++) {
+        items.emplace_back(i, i * 10);
+    }
+    inst.put_many(items);
+    inst.put(500, 5, 1ms);
+    std::this_thread::sleep_for(5ms);
+    std::vector<int> keys;
+    for (int i = 0; i < 200; i += 2) {
+        keys.push_back(i);
+    }
+    keys.push_back(500);
+    keys.push_back(4);
+    auto results = inst.get_many(keys);
+    ASSERT_EQ(results.size(), keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        if (keys[i] < 100) {
+            ASSERT_TRUE(results[i].has_value());
+            EXPECT_EQ(std::get<1>(*results[i]), keys[i] * 10);
+        } else {
+            EXPECT_FALSE(results[i].has_value());
+        }
+    }
+    EXPECT_EQ(inst.size(), 100);
+}
+
+TEST(lru_lookup_test, sharded_batch)
+{
+    sharded_lru<std::string, int, 1024, 8, false> inst{1h};
+    std::vector<std::pair<std::string, int>> items;
+    std::vector<std::string>                 keys;
+    for (int i = 0; i < 300; i++) {
+        items.emplace_back("key" + std::to_string(i), i);
+        keys.push_back("key" + std::to_string(299 - i));
+    }
+    keys.emplace_back("missing");
+    inst.put_many(items);
+    EXPECT_EQ(inst.size(), 300);
+    auto results = inst.get_many(keys);
+    ASSERT_EQ(results.size(), keys.size());
+    for (int i = 0; i < 300; i++) {
+        ASSERT_TRUE(results[i].has_value());
+        EXPECT_EQ(std::get<0>(*results[i]), keys[i]);
+        EXPECT_EQ(std::get<1>(*results[i]), 299 - i);
+    }
+    EXPECT_FALSE(results.back().has_value());
+}
@@ -0,0 +1,131 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/policies/arc_policy.hpp>
+#include <xitren/cache/policies/tiny_lfu_policy.hpp>
+#include <xitren/cache/policies/two_queue_policy.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <random>
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+template <template <class, std::size_t> class Policy>
+void
+check_basic_operations()
+{
+    lru<int, std::string, 8, false, Policy> inst{1s};
+    inst.put(11, "First data");
+    auto item = inst.get(11);
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::get<1>(*item), "First data");
+    inst.put(11, "Second data");
+    EXPECT_EQ(std::get<1>(*inst.get(11)), "Second data");
+    EXPECT_FALSE(inst.get(12).has_value());
+    EXPECT_EQ(inst.size(), 1);
+}
+
+template <template <class, std::size_t> class Policy>
+void
+check_capacity_is_bounded()
+{
+    lru<int, int, 64, false, Policy> inst{1h};
+    std::mt19937                     gen{7};
+    std::uniform_int_distribution    keys{0, 1023};
+    for (int i = 0; i < 50'000; i++) {
+        auto const key = keys(gen);
+        if (auto item = inst.get(key); item) {
+            ASSERT_EQ(std::get<1>(*item), key);
+        } else {
+            inst.put(key, key);
+        }
+        ASSERT_LE(inst.size(), 64);
+    }
+}
+
+template <template <class, std::size_t> class Policy>
+std::size_t
+hot_keys_after_scan()
+{
+    constexpr int                     hot = 50;
+    lru<int, int, 100, false, Policy> inst{1h};
+    auto                              access = [&inst](int key) {
+        if (!inst.get(key)) {
+            inst.put(key, key);
+        }
+    };
+    int cold = 1'000;
+    for (int round = 0; round < 20; round++) {
+        for (int key = 0; key < hot; key++) {
+            access(key);
+            if (key % 2) {
+                access(cold++);
+            }
+        }
+    }
+    for (int key = 100'000; key < 101'000; key++) {
+        access(key);
+    }
+    std::size_t hits{};
+    for (int key = 0; key < hot; key++) {
+        hits += inst.touch(key);
+    }
+    return hits;
+}
+
+TEST(lru_policies_test, basic_operations)
+{
+    check_basic_operations<lru_policy>();
+    check_basic_operations<two_queue_policy>();
+    check_basic_operations<arc_policy>();
+    check_basic_operations<tiny_lfu_policy>();
+}
+
+TEST(lru_policies_test, capacity_is_bounded)
+{
+    check_capacity_is_bounded<lru_policy>();
+    check_capacity_is_bounded<two_queue_policy>();
+    check_capacity_is_bounded<arc_policy>();
+    check_capacity_is_bounded<tiny_lfu_policy>();
+}
+
+TEST(lru_policies_test, scan_resistance)
+{
+    auto const lru_hits      = hot_keys_after_scan<lru_policy>();
+    auto const two_q_hits    = hot_keys_after_scan<two_queue_policy>();
+    auto const arc_hits      = hot_keys_after_scan<arc_policy>();
+    auto const tiny_lfu_hits = hot_keys_after_scan<tiny_lfu_policy>();
+    std::cout << "Hot keys kept: lru " << lru_hits << ", 2Q " << two_q_hits << ", ARC " << arc_hits
+              << ", W-TinyLFU " << tiny_lfu_hits << "\n";
+    EXPECT_EQ(lru_hits, 0);
+    EXPECT_GE(two_q_hits, 40);
+    EXPECT_GE(arc_hits, 40);
+    EXPECT_GE(tiny_lfu_hits, 40);
+}
+
+TEST(lru_policies_test, expired_items_leave_policy)
+{
+    lru<int, int, 4, false, arc_policy> inst{10ms};
+    for (int i = 0; i < 4; i++) {
+        inst.put(i, i);
+    }
+    std::this_thread::sleep_for(20ms);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_FALSE(inst.get(i).has_value());
+    }
+    EXPECT_EQ(inst.size(), 0);
+    for (int i = 4; i < 8; i++) {
+        inst.put(i, i);
+    }
+    EXPECT_EQ(inst.size(), 4);
+}
+
+TEST(lru_policies_test, sharded_with_policy)
+{
+    sharded_lru<int, int, 64, 4, false, tiny_lfu_policy> inst{1s};
+    inst.put(1, 1);
+    EXPECT_EQ(std::get<1>(*inst.get(1)), 1);
+}
@@ -0,0 +1,58 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+TEST(lru_result_test, hit_miss_and_expired)
+{
+    lru<int, std::string, 8, true> inst{1h};
+    inst.put(1, "first");
+    inst.put(2, "second", 1ms);
+    std::this_thread::sleep_for(5ms);
+
+    auto hit = inst.try_get(1);
+    ASSERT_TRUE(hit);
+    EXPECT_EQ(hit.status(), lookup_status::hit);
+    EXPECT_EQ(*hit, "first");
+    EXPECT_EQ(hit->size(), 5);
+
+    lookup_result<std::string&> expired = lookup_status::miss;
+    EXPECT_NO_THROW({ expired = inst.try_get(2); });
+    EXPECT_FALSE(expired);
+    EXPECT_TRUE(expired.expired());
+    EXPECT_EQ(inst.size(), 1);
+
+    auto missed = inst.try_get(3);
+    EXPECT_EQ(missed.status(), lookup_status::miss);
+    EXPECT_EQ(missed.value_or("none"), "none");
+}
+
+TEST(lru_result_test, refers_to_cached_value)
+{
+    lru<int, std::unique_ptr<int>, 8, false> inst{1h};
+    inst.emplace(1, std::make_unique<int>(1));
+    auto result = inst.try_get(1);
+    ASSERT_TRUE(result.has_value());
+    **result = 7;
+    EXPECT_EQ(**inst.find(1), 7);
+}
+
+TEST(lru_result_test, sharded_copies_value)
+{
+    sharded_lru<int, std::string, 64, 4, true> inst{1h};
+    inst.put(1, "first");
+    inst.put(2, "second", 1ms);
+    std::this_thread::sleep_for(5ms);
+    lookup_result<std::string> hit = inst.try_get(1);
+    ASSERT_TRUE(hit);
+    EXPECT_EQ(hit.value(), "first");
+    EXPECT_TRUE(inst.try_get(2).expired());
+    EXPECT_EQ(inst.try_get(3).status(), lookup_status::miss);
+}
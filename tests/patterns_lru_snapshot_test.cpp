@@ -0,0 +1,138 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct point {
+    std::int32_t x;
+    std::int32_t y;
+    double       weight;
+};
+
+std::filesystem::path
+snapshot_file(char const* name)
+{
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path;
+}
+
+}    // namespace
+
+TEST(lru_snapshot_test, save_and_restore)
+{
+    auto const file = snapshot_file("patterns_lru_snapshot_test.bin");
+    {
+        lru<std::uint64_t, point, 64, false> inst{1h};
+        for (std::uint64_t i = 0; i < 50; i++) {
+            inst.put(i, point{static_cast<std::int32_t>(i), -static_cast<std::int32_t>(i), 0.5 * i});
+        }
+        inst.put(100, point{}, 1ms);
+        std::this_thread::sleep_for(5ms);
+        EXPECT_TRUE(inst.save(file));
+    }
+    lru<std::uint64_t, point, 64, false> restored{1h};
+    EXPECT_EQ(restored.restore(file), 50);
+    EXPECT_EQ(restored.size(), 50);
+    for (std::uint64_t i = 0; i < 50; i++) {
+        auto item = restored.get(i);
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(std::get<1>(*item).x, static_cast<std::int32_t>(i));
+        EXPECT_EQ(std::get<1>(*item).y, -static_cast<std::int32_t>(i));
+        EXPECT_DOUBLE_EQ(std::get<1>(*item).weight, 0.5 * i);
+    }
+    EXPECT_FALSE(restored.get(100).has_value());
+    std::filesystem::remove(file);
+}
+
+TEST(lru_snapshot_test, keeps_recency_and_ttl)
+{
+    auto const file = snapshot_file("patterns_lru_snapshot_recency_test.bin");
+    {
+        lru<int, int, 8, false> inst{1h};
+        for (int i = 0; i < 8; i++) {
+            inst.put(i, i, (i == 7) ? 20ms : 1h);
+        }
+        inst.put(0, 100);
+        EXPECT_TRUE(inst.save(file));
+    }
+    lru<int, int, 8, false> restored{1h};
+    EXPECT_EQ(restored.restore(file), 8);
+    restored.put(50, 50);
+    EXPECT_FALSE(restored.touch(1));
+    EXPECT_EQ(std::get<1>(*restored.get(0)), 100);
+    std::this_thread::sleep_for(30ms);
+    EXPECT_FALSE(restored.get(7).has_value());
+    std::filesystem::remove(file);
+}
+
+TEST(lru_snapshot_test, reads_count_as_use)
+{
+    auto const file = snapshot_file("patterns_lru_snapshot_reads_test.bin");
+    {
+        lru<int, int, 8, false> inst{1h};
+        for (int i = 0; i < 8; i++) {
+            inst.put(i, i);
+        }
+        EXPECT_TRUE(inst.get(0).has_value());
+        EXPECT_TRUE(inst.touch(1));
+        EXPECT_TRUE(inst.save(file));
+    }
+    lru<int, int, 8, false> restored{1h};
+    EXPECT_EQ(restored.restore(file), 8);
+    restored.put(50, 50);
+    restored.put(51, 51);
+    EXPECT_TRUE(restored.touch(0));
+    EXPECT_TRUE(restored.touch(1));
+    EXPECT_FALSE(restored.touch(2));
+    EXPECT_FALSE(restored.touch(3));
+    std::filesystem::remove(file);
+}
+
+TEST(lru_snapshot_test, rejects_foreign_files)
+{
+    auto const file = snapshot_file("patterns_lru_snapshot_foreign_test.bin");
+    lru<int, int, 8, false> inst{1h};
+    EXPECT_EQ(inst.restore(file), 0);
+    {
+        std::ofstream garbage{file, std::ios::binary};
+        garbage << "definitely not a snapshot of this cache";
+    }
+    EXPECT_EQ(inst.restore(file), 0);
+    {
+        lru<int, std::array<char, 16>, 8, false> other{1h};
+        other.put(1, {});
+        EXPECT_TRUE(other.save(file));
+    }
+    EXPECT_EQ(inst.restore(file), 0);
+    EXPECT_EQ(inst.size(), 0);
+    std::filesystem::remove(file);
+}
+
+TEST(lru_snapshot_test, sharded)
+{
+    auto const file = snapshot_file("patterns_sharded_lru_snapshot_test.bin");
+    {
+        sharded_lru<int, std::uint64_t, 256, 8, false> inst{1h};
+        for (int i = 0; i < 200; i++) {
+            inst.put(i, static_cast<std::uint64_t>(i) * 3);
+        }
+        EXPECT_TRUE(inst.save(file));
+    }
+    sharded_lru<int, std::uint64_t, 256, 8, false> restored{1h};
+    EXPECT_EQ(restored.restore(file), 200);
+    for (int i = 0; i < 200; i++) {
+        ASSERT_EQ(std::get<1>(*restored.get(i)), static_cast<std::uint64_t>(i) * 3);
+    }
+    std::filesystem::remove(file);
+}
@@ -0,0 +1,98 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+using counted_lru = lru<int, int, 4, false, lru_policy, std::chrono::steady_clock, unit_weigher, cache_stats>;
+
+TEST(lru_stats_test, counters)
+{
+    counted_lru inst{1h};
+    for (int i = 0; i < 6; i++) {
+        inst.put(i, i);
+    }
+    EXPECT_TRUE(inst.get(5).has_value());
+    EXPECT_TRUE(inst.touch(4));
+    EXPECT_FALSE(inst.get(0).has_value());
+    inst.put(10, 10, 1ms);
+    std::this_thread::sleep_for(5ms);
+    EXPECT_FALSE(inst.get(10).has_value());
+
+    auto const stats = inst.stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.evictions, 3);
+    EXPECT_EQ(stats.expirations, 1);
+    EXPECT_EQ(stats.size, 3);
+    EXPECT_EQ(stats.weight, 3);
+    EXPECT_DOUBLE_EQ(stats.hit_ratio(), 0.5);
+}
+
+TEST(lru_stats_test, reaped_entries_are_expirations)
+{
+    counted_lru inst{1ms};
+    inst.put(1, 1);
+    inst.put(2, 2);
+    std::this_thread::sleep_for(5ms);
+    EXPECT_EQ(inst.reap(10), 2);
+    EXPECT_EQ(inst.stats().expirations, 2);
+    EXPECT_EQ(inst.stats().evictions, 0);
+}
+
+TEST(lru_stats_test, disabled_by_default)
+{
+    lru<int, int, 4, false> inst{1h};
+    inst.put(1, 1);
+    inst.get(1);
+    inst.get(2);
+    auto const stats = inst.stats();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.misses, 0);
+    EXPECT_EQ(stats.size, 1);
+    EXPECT_FALSE(no_stats::enabled);
+    EXPECT_EQ(sizeof(lru<int, int, 4, false>),
+              sizeof(lru<int, int, 4, false, lru_policy, std::chrono::steady_clock, unit_weigher, no_stats>));
+}
+
+TEST(lru_stats_test, sharded_totals)
+{
+    sharded_lru<int, int, 64, 4, false, lru_policy, std::chrono::steady_clock, unit_weigher, cache_stats> inst{1h};
+    for (int i = 0; i < 32; i++) {
+        inst.put(i, i);
+    }
+    std::vector<int> keys;
+    for (int i = 0; i < 64; i++) {
+        keys.push_back(i);
+    }
+    inst.get_many(keys);
+    auto const stats = inst.stats();
+    EXPECT_EQ(stats.hits, 32);
+    EXPECT_EQ(stats.misses, 32);
+    EXPECT_EQ(stats.size, 32);
+}
+
+TEST(lru_stats_test, snapshots_while_in_use)
+{
+    counted_lru       inst{1h};
+    std::atomic<bool> done{false};
+    std::thread       monitor{[&inst, &done]() {
+        while (!done) {
+            /* An insert is counted just before the eviction it causes. */
+            EXPECT_LE(inst.stats().size, 5);
+        }
+    }};
+    for (int i = 0; i < 10'000; i++) {
+        inst.put(i % 7, i);
+        inst.get(i % 5);
+    }
+    done = true;
+    monitor.join();
+    EXPECT_EQ(inst.stats().size, 4);
+}
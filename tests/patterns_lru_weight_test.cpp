@@ -0,0 +1,108 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/policies/arc_policy.hpp>
+#include <xitren/cache/policies/tiny_lfu_policy.hpp>
+#include <xitren/cache/policies/two_queue_policy.hpp>
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct byte_weigher {
+    std::size_t
+    operator()(int const&, std::string const& value) const noexcept
+    {
+        return value.size();
+    }
+};
+
+template <template <class, std::size_t> class Policy>
+void
+check_budget_is_kept()
+{
+    using cache_type = lru<int, std::string, 1024, false, Policy, std::chrono::steady_clock, byte_weigher>;
+    constexpr std::size_t                      budget = 4096;
+    cache_type                                 inst{1h, budget};
+    std::mt19937                               gen{3};
+    std::uniform_int_distribution              keys{0, 511};
+    std::uniform_int_distribution<std::size_t> sizes{32, 512};
+    for (int i = 0; i < 20'000; i++) {
+        auto const key = keys(gen);
+        if (!inst.get(key)) {
+            inst.put(key, std::string(sizes(gen), 'x'));
+        }
+        ASSERT_LE(inst.weight(), budget);
+    }
+    EXPECT_GT(inst.size(), 0);
+}
+
+}    // namespace
+
+TEST(lru_weight_test, unit_weight_is_size)
+{
+    lru<int, int, 8, false> inst{1h};
+    for (int i = 0; i < 20; i++) {
+        inst.put(i, i);
+        EXPECT_EQ(inst.weight(), inst.size());
+    }
+    EXPECT_EQ(inst.max_weight(), unlimited_weight);
+}
+
+TEST(lru_weight_test, evicts_until_budget_fits)
+{
+    lru<int, std::string, 64, false, lru_policy, std::chrono::steady_clock, byte_weigher> inst{1h, 100};
+    inst.put(1, std::string(40, 'a'));
+    inst.put(2, std::string(40, 'b'));
+    EXPECT_EQ(inst.weight(), 80);
+    EXPECT_TRUE(inst.touch(1));
+    inst.put(3, std::string(40, 'c'));
+    EXPECT_EQ(inst.weight(), 80);
+    EXPECT_TRUE(inst.get(1).has_value());
+    EXPECT_FALSE(inst.get(2).has_value());
+    EXPECT_TRUE(inst.get(3).has_value());
+
+    inst.put(3, std::string(90, 'c'));
+    EXPECT_EQ(inst.weight(), 90);
+    EXPECT_EQ(inst.size(), 1);
+    inst.put(4, std::string(200, 'd'));
+    EXPECT_FALSE(inst.get(4).has_value());
+    EXPECT_LE(inst.weight(), 100);
+}
+
+TEST(lru_weight_test, expired_entries_release_weight)
+{
+    lru<int, std::string, 64, false, lru_policy, std::chrono::steady_clock, byte_weigher> inst{1h, 1000};
+    inst.put(1, std::string(10, 'a'), 1ms);
+    inst.put(2, std::string(20, 'b'), 1ms);
+    inst.put(3, std::string(30, 'c'));
+    std::this_thread::sleep_for(5ms);
+    EXPECT_FALSE(inst.get(1).has_value());
+    EXPECT_EQ(inst.weight(), 50);
+    EXPECT_EQ(inst.reap(10), 1);
+    EXPECT_EQ(inst.weight(), 30);
+}
+
+TEST(lru_weight_test, policies_keep_budget)
+{
+    check_budget_is_kept<lru_policy>();
+    check_budget_is_kept<two_queue_policy>();
+    check_budget_is_kept<arc_policy>();
+    check_budget_is_kept<tiny_lfu_policy>();
+}
+
+TEST(lru_weight_test, sharded_budget)
+{
+    sharded_lru<int, std::string, 256, 4, false, lru_policy, std::chrono::steady_clock, byte_weigher> inst{1h, 4000};
+    for (int i = 0; i < 256; i++) {
+        inst.put(i, std::string(100, 'x'));
+    }
+    EXPECT_LE(inst.weight(), 4000);
+    EXPECT_EQ(inst.weight(), inst.size() * 100);
+}
@@ -0,0 +1,111 @@
+#include <xitren/allocators/monotonic_arena.hpp>
+#include <xitren/allocators/static_heap.hpp>
+#include <xitren/allocators/static_heap_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace xitren::allocators;
+
+TEST(TestMonotonicArena, BumpsAlignedPointers)
+{
+    monotonic_arena<256> arena{};
+    auto*                ptr1 = static_cast<char*>(arena.allocate(1, 1));
+    auto*                ptr2 = static_cast<char*>(arena.allocate(1, 1));
+    EXPECT_EQ(ptr2, ptr1 + 1);
+
+    auto* ptr3 = arena.allocate(8, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr3) % 64, 0);
+    auto* ptr4 = arena.allocate(8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr4) % alignof(std::max_align_t), 0);
+    EXPECT_EQ(arena.used(), 18);
+
+    arena.deallocate(ptr1);
+    EXPECT_EQ(arena.used(), 18);
+}
+
+TEST(TestMonotonicArena, ResetFreesEverything)
+{
+    monotonic_arena<128> arena{};
+    auto*                first = arena.allocate(64);
+    EXPECT_NE(arena.allocate(64), nullptr);
+    EXPECT_EQ(arena.allocate(1), nullptr);
+    EXPECT_EQ(arena.free_heap_size(), 0);
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0);
+    EXPECT_EQ(arena.free_heap_size(), 128);
+    EXPECT_EQ(arena.allocate(64), first);
+}
+
+TEST(TestMonotonicArena, RollsBackLastAllocation)
+{
+    monotonic_arena<128> arena{};
+    auto*                ptr1 = arena.allocate(16);
+    auto*                ptr2 = arena.allocate(16);
+    arena.deallocate(ptr1, 16);
+    EXPECT_EQ(arena.used(), 32);
+    arena.deallocate(ptr2, 16);
+    EXPECT_EQ(arena.used(), 16);
+    EXPECT_EQ(arena.allocate(16), ptr2);
+}
+
+TEST(TestMonotonicArena, ChunksFromUpstream)
+{
+    auto heap = std::make_unique<static_heap<16384>>();
+    auto free = heap->free_heap_size();
+    {
+        monotonic_arena<64, static_heap<16384>> arena{*heap, 256};
+        std::vector<void*>                      blocks;
+        for (int i{}; i < 32; i++) {
+            auto* block = arena.allocate(32);
+            ASSERT_NE(block, nullptr);
+            blocks.push_back(block);
+        }
+        EXPECT_LT(heap->free_heap_size(), free);
+        EXPECT_NE(arena.allocate(1024), nullptr);
+        EXPECT_EQ(arena.allocate(1 << 20), nullptr);
+
+        arena.reset();
+        EXPECT_EQ(heap->free_heap_size(), free);
+        EXPECT_EQ(arena.allocate(32), blocks.front());
+        EXPECT_NE(arena.allocate(64), nullptr);
+    }
+    EXPECT_EQ(heap->free_heap_size(), free);
+}
+
+TEST(TestMonotonicArena, MemoryResource)
+{
+    monotonic_arena<4096> arena{};
+    {
+        std::pmr::vector<std::pmr::string> words{&arena};
+        for (int i{}; i < 16; i++) {
+            words.emplace_back("a string long enough to leave the small buffer");
+        }
+        EXPECT_EQ(words.back().get_allocator().resource(), &arena);
+    }
+    EXPECT_GT(arena.used(), 0);
+
+    std::pmr::memory_resource& resource = arena;
+    EXPECT_TRUE(resource.is_equal(arena));
+    EXPECT_THROW(static_cast<void>(resource.allocate(8192)), std::bad_alloc);
+}
+
+TEST(TestMonotonicArena, StaticHeapAllocatorInterface)
+{
+    monotonic_arena<1024>                          arena{};
+    monotonic_arena_allocator<std::uint32_t, 1024> alloc{arena};
+    std::vector<std::uint32_t, decltype(alloc)>    values{alloc};
+    for (std::uint32_t i{}; i < 64; i++) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(values[63], 63);
+    EXPECT_LE(arena.used(), 1024);
+    EXPECT_THROW(values.reserve(1024), std::bad_alloc);
+}
@@ -0,0 +1,69 @@
+#include <xitren/cache/perfect_table.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+using namespace xitren::cache;
+
+namespace {
+
+using code_item = std::pair<std::string_view, int>;
+
+constexpr perfect_table<std::string_view, int, 5> codes{std::array{
+    code_item{"ok", 200}, code_item{"created", 201}, code_item{"not found", 404}, code_item{"teapot", 418},
+    code_item{"unavailable", 503}}};
+
+constexpr auto
+make_squares()
+{
+    std::array<std::pair<std::uint32_t, std::uint32_t>, 1000> items{};
+    for (std::uint32_t i = 0; i < items.size(); i++) {
+        items[i] = {i * 7919, i * i};
+    }
+    return items;
+}
+
+constexpr perfect_table squares{make_squares()};
+
+}    // namespace
+
+static_assert(*codes.find("teapot") == 418);
+static_assert(codes.contains("ok"));
+static_assert(!codes.contains("gone"));
+static_assert(codes.try_get("created").value() == 201);
+static_assert(squares.size() == 1000);
+
+TEST(perfect_table_test, string_keys)
+{
+    std::string_view const found{"not found"};
+    ASSERT_NE(codes.find(found), nullptr);
+    EXPECT_EQ(*codes.find(found), 404);
+    EXPECT_EQ(codes.find(std::string_view{"not"}), nullptr);
+    EXPECT_EQ(codes.find(std::string_view{}), nullptr);
+
+    auto missed = codes.try_get("moved");
+    EXPECT_EQ(missed.status(), lookup_status::miss);
+    EXPECT_EQ(missed.value_or(0), 0);
+}
+
+TEST(perfect_table_test, integral_keys)
+{
+    for (std::uint32_t i = 0; i < 1000; i++) {
+        auto const* value = squares.find(i * 7919);
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, i * i);
+        EXPECT_FALSE(squares.contains(i * 7919 + 1));
+    }
+    EXPECT_FALSE(squares.contains(0xFFFFFFFFU));
+}
+
+TEST(perfect_table_test, single_key)
+{
+    static constexpr perfect_table<int, char, 1> single{std::array{std::pair{0, 'a'}}};
+    EXPECT_EQ(*single.find(0), 'a');
+    EXPECT_FALSE(single.contains(1));
+}
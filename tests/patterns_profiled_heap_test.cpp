@@ -0,0 +1,177 @@
+#include <xitren/allocators/concurrent_heap.hpp>
+#include <xitren/allocators/profiled_heap.hpp>
+#include <xitren/allocators/static_heap.hpp>
+#include <xitren/allocators/static_heap_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+using namespace xitren::allocators;
+
+namespace {
+
+/* Every call to now() advances by 100 ns, so each allocation takes exactly that long. */
+struct step_clock {
+    using duration   = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<step_clock>;
+
+    static inline std::int64_t ticks{};
+
+    static time_point
+    now() noexcept
+    {
+        ticks += 100;
+        return time_point{duration{ticks}};
+    }
+};
+
+}    // namespace
+
+TEST(TestProfiledHeap, SizeClassesAndHighWaterMarks)
+{
+    using heap_t = profiled_heap<static_heap<16384>>;
+    static_assert(heap_t::size_class_of(1) == 0);
+    static_assert(heap_t::size_class_of(16) == 4);
+    static_assert(heap_t::size_class_of(17) == 5);
+    static_assert(heap_t::header_size == 16);
+
+    auto               manager = std::make_unique<heap_t>();
+    std::vector<void*> small;
+    for (int i = 0; i < 10; i++) {
+        small.push_back(manager->allocate(12));
+    }
+    auto* large = manager->allocate(1000);
+    EXPECT_EQ(manager->live_bytes(), 10 * 12 + 1000);
+    for (int i = 0; i < 6; i++) {
+        manager->deallocate(small.back());
+        small.pop_back();
+    }
+    manager->deallocate(large);
+
+    auto const classes = manager->size_histogram();
+    EXPECT_EQ(classes[4].allocations, 10);
+    EXPECT_EQ(classes[4].live_blocks, 4);
+    EXPECT_EQ(classes[4].live_bytes, 48);
+    EXPECT_EQ(classes[4].peak_blocks, 10);
+    EXPECT_EQ(classes[4].peak_bytes, 120);
+    EXPECT_EQ(classes[10].allocations, 1);
+    EXPECT_EQ(classes[10].live_blocks, 0);
+    EXPECT_EQ(classes[10].peak_bytes, 1000);
+    EXPECT_EQ(manager->peak_live_bytes(), 1120);
+
+    EXPECT_EQ(manager->allocate(1 << 20), nullptr);
+    EXPECT_EQ(manager->failed_allocations(), 1);
+
+    manager->reset_profile();
+    EXPECT_EQ(manager->size_histogram()[4].allocations, 0);
+    EXPECT_EQ(manager->size_histogram()[4].peak_blocks, 4);
+    EXPECT_EQ(manager->peak_live_bytes(), 48);
+    for (auto* ptr : small) {
+        manager->deallocate(ptr);
+    }
+    EXPECT_EQ(manager->live_bytes(), 0);
+}
+
+TEST(TestProfiledHeap, LatencyHistogram)
+{
+    profiled_heap<static_heap<4096, heap_mode::tlsf>, step_clock> manager{};
+    for (int i = 0; i < 5; i++) {
+        manager.deallocate(manager.allocate(64));
+    }
+    auto const latencies = manager.latency_histogram();
+    EXPECT_EQ(std::accumulate(latencies.begin(), latencies.end(), std::size_t{}), 5);
+    EXPECT_EQ(latencies[7], 5);
+}
+
+TEST(TestProfiledHeap, Fragmentation)
+{
+    auto manager = std::make_unique<profiled_heap<static_heap<8192>>>();
+    EXPECT_DOUBLE_EQ(manager->fragmentation(), 0.0);
+
+    std::vector<void*> blocks;
+    while (auto* ptr = manager->allocate(100)) {
+        blocks.push_back(ptr);
+    }
+    for (std::size_t i = 0; i < blocks.size(); i += 2) {
+        manager->deallocate(blocks[i]);
+    }
+    EXPECT_GT(manager->fragmentation(), 0.9);
+    for (std::size_t i = 1; i < blocks.size(); i += 2) {
+        manager->deallocate(blocks[i]);
+    }
+    EXPECT_DOUBLE_EQ(manager->fragmentation(), 0.0);
+}
+
+TEST(TestProfiledHeap, CallSiteTags)
+{
+    using heap_t = profiled_heap<static_heap<8192>, std::chrono::steady_clock, 3>;
+
+    auto  manager = std::make_unique<heap_t>();
+    void* parsed{};
+    void* routed{};
+    void* other{};
+    {
+        heap_t::tag_scope parser{*manager, "parser"};
+        parsed = manager->allocate(100);
+        {
+            heap_t::tag_scope router{*manager, "router"};
+            routed = manager->allocate(30);
+            heap_t::tag_scope overflow{*manager, "overflow"};
+            other = manager->allocate(5);
+        }
+        manager->deallocate(manager->allocate(50));
+    }
+    manager->deallocate(manager->allocate(7));
+
+    auto const tags = manager->tags();
+    ASSERT_EQ(tags.size(), 3);
+    EXPECT_EQ(tags[0].name, "untagged");
+    EXPECT_EQ(tags[0].allocations, 2);
+    EXPECT_EQ(tags[0].live_bytes, 5);
+    EXPECT_EQ(tags[1].name, "parser");
+    EXPECT_EQ(tags[1].allocations, 2);
+    EXPECT_EQ(tags[1].live_bytes, 100);
+    EXPECT_EQ(tags[1].peak_bytes, 150);
+    EXPECT_EQ(tags[2].name, "router");
+    EXPECT_EQ(tags[2].live_blocks, 1);
+
+    std::ostringstream report;
+    manager->dump(report);
+    EXPECT_NE(report.str().find("fragmentation"), std::string::npos);
+    EXPECT_NE(report.str().find("parser"), std::string::npos);
+    EXPECT_NE(report.str().find("router"), std::string::npos);
+
+    manager->deallocate(parsed);
+    manager->deallocate(routed);
+    manager->deallocate(other);
+}
+
+TEST(TestProfiledHeap, AllocatorAndAlignedBlocks)
+{
+    struct alignas(64) line {
+        std::uint64_t value;
+    };
+    using heap_t = profiled_heap<concurrent_heap<16384>>;
+
+    auto       manager = std::make_unique<heap_t>();
+    auto const initial = manager->free_heap_size();
+    {
+        static_heap_allocator<line, 16384, heap_mode::first_fit, heap_t> alloc{*manager};
+        std::list<line, decltype(alloc)>                                  lines{alloc};
+        for (std::uint64_t i = 0; i < 10; i++) {
+            lines.push_back({i});
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&lines.back()) % 64, 0);
+        }
+        EXPECT_EQ(manager->tags()[0].live_blocks, 10);
+    }
+    EXPECT_EQ(manager->live_bytes(), 0);
+    manager->heap().flush();
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
@@ -0,0 +1,209 @@
+#include <xitren/allocators/mapped_region.hpp>
+#include <xitren/allocators/region_heap.hpp>
+#include <xitren/allocators/static_heap_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace xitren::allocators;
+
+namespace {
+
+struct buffers {
+    alignas(64) std::array<std::uint8_t, 4096> low{};
+    alignas(64) std::array<std::uint8_t, 1024> gap{};
+    alignas(64) std::array<std::uint8_t, 4096> high{};
+};
+
+bool
+inside(void const* pointer, std::array<std::uint8_t, 4096> const& buffer)
+{
+    auto const* byte = static_cast<std::uint8_t const*>(pointer);
+    return (byte >= buffer.data()) && (byte < buffer.data() + buffer.size());
+}
+
+}    // namespace
+
+TEST(TestRegionHeap, RegionsInAnyOrder)
+{
+    auto           memory = std::make_unique<buffers>();
+    region_heap<4> manager{};
+    EXPECT_EQ(manager.allocate(16), nullptr);
+
+    ASSERT_TRUE(manager.add_region(memory->high.data(), memory->high.size()));
+    ASSERT_TRUE(manager.add_region(memory->low.data(), memory->low.size()));
+    EXPECT_FALSE(manager.add_region(memory->low.data() + 100, 200));
+    EXPECT_FALSE(manager.add_region(memory->gap.data(), 8));
+    EXPECT_EQ(manager.region_count(), 2);
+    auto const initial = manager.free_heap_size();
+    EXPECT_GT(initial, 8000);
+
+    /* First fit takes the region with the lower address first, then continues in the other one. */
+    std::vector<void*> blocks;
+    while (auto* ptr = manager.allocate(500)) {
+        blocks.push_back(ptr);
+    }
+    ASSERT_GE(blocks.size(), 14);
+    EXPECT_TRUE(inside(blocks.front(), memory->low));
+    EXPECT_TRUE(inside(blocks.back(), memory->high));
+
+    /* A block never spans two regions, even when both have room left at their ends. */
+    for (auto* ptr : blocks) {
+        EXPECT_TRUE(inside(ptr, memory->low) ? inside(static_cast<std::uint8_t*>(ptr) + 499, memory->low)
+                                             : inside(static_cast<std::uint8_t*>(ptr) + 499, memory->high));
+    }
+
+    for (auto* ptr : blocks) {
+        manager.deallocate(ptr);
+    }
+    EXPECT_EQ(manager.free_heap_size(), initial);
+    heap_stats stats{};
+    manager.v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 2);
+    EXPECT_EQ(stats.x_number_of_successful_allocations, blocks.size());
+    EXPECT_EQ(stats.x_number_of_successful_frees, blocks.size());
+}
+
+TEST(TestRegionHeap, PerRegionStats)
+{
+    auto           memory = std::make_unique<buffers>();
+    region_heap<2> manager{};
+    ASSERT_TRUE(manager.add_region(memory->low.data(), memory->low.size()));
+    ASSERT_TRUE(manager.add_region(memory->high.data(), memory->high.size()));
+    EXPECT_FALSE(manager.add_region(memory->gap.data(), memory->gap.size()));
+
+    heap_stats low{}, high{};
+    manager.v_port_get_region_stats(0, &low);
+    auto const capacity = low.x_available_heap_space_in_bytes;
+
+    auto* ptr1 = manager.allocate(1000);
+    auto* ptr2 = manager.allocate(1000);
+    auto* ptr3 = manager.allocate(3000);
+    ASSERT_TRUE(inside(ptr3, memory->high));
+    manager.deallocate(ptr1);
+
+    ASSERT_TRUE(manager.v_port_get_region_stats(0, &low));
+    ASSERT_TRUE(manager.v_port_get_region_stats(1, &high));
+    EXPECT_FALSE(manager.v_port_get_region_stats(2, &high));
+    EXPECT_EQ(low.x_number_of_successful_allocations, 2);
+    EXPECT_EQ(low.x_number_of_successful_frees, 1);
+    EXPECT_EQ(low.x_number_of_free_blocks, 2);
+    EXPECT_LT(low.x_minimum_ever_free_bytes_remaining, low.x_available_heap_space_in_bytes);
+    EXPECT_EQ(high.x_number_of_successful_allocations, 1);
+    EXPECT_EQ(high.x_number_of_free_blocks, 1);
+    EXPECT_EQ(low.x_available_heap_space_in_bytes + high.x_available_heap_space_in_bytes, manager.free_heap_size());
+
+    manager.deallocate(ptr2);
+    manager.deallocate(ptr3);
+    manager.v_port_get_region_stats(0, &low);
+    EXPECT_EQ(low.x_available_heap_space_in_bytes, capacity);
+    EXPECT_EQ(low.x_size_of_largest_free_block_in_bytes, capacity);
+}
+
+TEST(TestRegionHeap, GrowsFromFailCallback)
+{
+    auto               memory = std::make_unique<buffers>();
+    region_heap<4, 16> manager{};
+    std::size_t        added{};
+    manager.on_fail([&]() {
+        if (added == 0) {
+            manager.add_region(memory->high.data(), memory->high.size());
+        }
+        added++;
+    });
+    ASSERT_TRUE(manager.add_region(memory->low.data(), memory->low.size()));
+
+    auto* ptr1 = manager.allocate(3000);
+    EXPECT_EQ(manager.allocate(3000), nullptr);
+    EXPECT_EQ(added, 1);
+    auto* ptr2 = manager.allocate(3000);
+    ASSERT_NE(ptr2, nullptr);
+    EXPECT_TRUE(inside(ptr2, memory->high));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr2) % 16, 0);
+
+    auto* aligned = manager.allocate_aligned(100, 256);
+    ASSERT_NE(aligned, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 256, 0);
+
+    int foreign{};
+    manager.deallocate(&foreign);
+    manager.deallocate(ptr1);
+    manager.deallocate(ptr1);
+    manager.deallocate(ptr2);
+    manager.deallocate(aligned);
+    heap_stats stats{};
+    manager.v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 2);
+    EXPECT_EQ(stats.x_number_of_successful_frees, 3);
+}
+
+TEST(TestRegionHeap, RandomWorkloadOverMappedRegions)
+{
+    mapped_region first{1 << 20};
+    mapped_region second{1 << 20, false};
+    EXPECT_EQ(first.size() % mapped_region::huge_page_size, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first.data()) % mapped_region::huge_page_size, 0);
+
+    auto manager = std::make_unique<region_heap<>>();
+    ASSERT_TRUE(manager->add_region(first.data(), first.size()));
+    ASSERT_TRUE(manager->add_region(second.data(), second.size()));
+    auto const initial = manager->free_heap_size();
+
+    std::map<std::uint8_t*, std::size_t>       live;
+    std::mt19937                               gen{11};
+    std::uniform_int_distribution<std::size_t> sizes{1, 20'000};
+    for (int i = 0; i < 20'000; i++) {
+        if (live.empty() || (gen() % 3 != 0)) {
+            auto const size = sizes(gen);
+            auto*      ptr  = static_cast<std::uint8_t*>(manager->allocate(size));
+            if (ptr == nullptr) {
+                continue;
+            }
+            auto const next = live.lower_bound(ptr);
+            if (next != live.end()) {
+                ASSERT_LE(ptr + size, next->first);
+            }
+            if (next != live.begin()) {
+                ASSERT_LE(std::prev(next)->first + std::prev(next)->second, ptr);
+            }
+            std::memset(ptr, static_cast<int>(size & 0xFF), size);
+            live.emplace(ptr, size);
+        } else {
+            auto victim = std::next(live.begin(), static_cast<std::ptrdiff_t>(gen() % live.size()));
+            ASSERT_EQ(victim->first[victim->second - 1], static_cast<std::uint8_t>(victim->second & 0xFF));
+            manager->deallocate(victim->first);
+            live.erase(victim);
+        }
+    }
+    for (auto [ptr, size] : live) {
+        manager->deallocate(ptr);
+    }
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
+
+TEST(TestRegionHeap, STLContainers)
+{
+    auto           memory = std::make_unique<buffers>();
+    region_heap<2> manager{};
+    manager.add_region(memory->low.data(), memory->low.size());
+    manager.add_region(memory->high.data(), memory->high.size());
+
+    using allocator = static_heap_allocator<int, 0, heap_mode::first_fit, region_heap<2>>;
+    std::list<int, allocator> list{allocator{manager}};
+    for (int i = 0; i < 200; i++) {
+        list.push_back(i);
+    }
+    EXPECT_EQ(list.back(), 199);
+    list.clear();
+    heap_stats stats{};
+    manager.v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 2);
+}
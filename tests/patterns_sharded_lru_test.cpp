@@ -0,0 +1,52 @@
+#include <xitren/cache/sharded_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+TEST(sharded_lru_test, simple_check)
+{
+    sharded_lru<int, std::string, 64, 4, false> inst{1s};
+    inst.put(11, "First data");
+    auto item = inst.get(11);
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::get<1>(*item), "First data");
+    EXPECT_FALSE(inst.get(12).has_value());
+    EXPECT_TRUE(inst.touch(11));
+    EXPECT_EQ(inst.size(), 1);
+}
+
+TEST(sharded_lru_test, capacity_is_bounded)
+{
+    sharded_lru<int, int, 64, 8, false> inst{1s};
+    for (int i = 0; i < 1000; i++) {
+        inst.put(i, i);
+    }
+    EXPECT_LE(inst.size(), 64);
+    EXPECT_EQ(std::get<1>(*inst.get(999)), 999);
+}
+
+TEST(sharded_lru_test, concurrent_access)
+{
+    sharded_lru<int, int, 1024, 16, false> inst{1h};
+    std::vector<std::thread>               workers;
+    for (int t = 0; t < 8; t++) {
+        workers.emplace_back([&inst, t]() {
+            for (int i = 0; i < 10'000; i++) {
+                auto const key = (i * 8 + t) % 512;
+                inst.put(key, key);
+                if (auto item = inst.get(key); item) {
+                    EXPECT_EQ(std::get<1>(*item), key);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_LE(inst.size(), 1024);
+}
@@ -0,0 +1,144 @@
+#include <xitren/allocators/concurrent_heap.hpp>
+#include <xitren/allocators/static_heap.hpp>
+#include <xitren/allocators/static_heap_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace xitren::allocators;
+
+namespace {
+
+bool
+is_aligned(void const* pointer, std::size_t alignment)
+{
+    return (reinterpret_cast<std::uintptr_t>(pointer) % alignment) == 0;
+}
+
+struct alignas(64) hot_counter {
+    std::uint64_t value;
+};
+
+}    // namespace
+
+template <heap_mode Mode>
+void
+expect_aligned_by_default()
+{
+    auto manager = std::make_unique<static_heap<8192, Mode, 64>>();
+    EXPECT_EQ((static_heap<8192, Mode, 64>::alignment), 64);
+    auto const         initial = manager->free_heap_size();
+    std::vector<void*> blocks;
+    for (std::size_t size = 1; size < 200; size += 13) {
+        auto* ptr = manager->allocate(size);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_TRUE(is_aligned(ptr, 64));
+        blocks.push_back(ptr);
+    }
+    auto* zeroed = static_cast<std::uint8_t*>(manager->callocate(3, 7));
+    ASSERT_NE(zeroed, nullptr);
+    EXPECT_TRUE(is_aligned(zeroed, 64));
+    blocks.push_back(zeroed);
+    for (auto* ptr : blocks) {
+        manager->deallocate(ptr);
+    }
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
+
+TEST(TestStaticHeapAligned, AlignmentParameter)
+{
+    expect_aligned_by_default<heap_mode::first_fit>();
+    expect_aligned_by_default<heap_mode::tlsf>();
+}
+
+template <heap_mode Mode>
+void
+expect_allocate_aligned()
+{
+    auto       manager = std::make_unique<static_heap<65536, Mode>>();
+    auto const initial = manager->free_heap_size();
+
+    std::vector<std::pair<std::uint8_t*, std::size_t>> blocks;
+    std::mt19937                                       gen{3};
+    std::uniform_int_distribution<std::size_t>         sizes{1, 300};
+    for (std::size_t alignment : {8, 16, 32, 64, 128, 256, 4096}) {
+        for (int i = 0; i < 6; i++) {
+            auto const size = sizes(gen);
+            auto*      ptr  = static_cast<std::uint8_t*>(manager->allocate_aligned(size, alignment));
+            ASSERT_NE(ptr, nullptr);
+            EXPECT_TRUE(is_aligned(ptr, alignment));
+            std::memset(ptr, static_cast<int>(size & 0xFF), size);
+            blocks.emplace_back(ptr, size);
+            /* Plain allocations reuse the space split off in front of aligned blocks. */
+            if (auto* plain = manager->allocate(16); plain != nullptr) {
+                blocks.emplace_back(static_cast<std::uint8_t*>(plain), 0);
+            }
+        }
+    }
+    for (auto [ptr, size] : blocks) {
+        for (std::size_t i{}; i < size; i++) {
+            ASSERT_EQ(ptr[i], static_cast<std::uint8_t>(size & 0xFF));
+        }
+        manager->deallocate(ptr);
+    }
+    EXPECT_EQ(manager->free_heap_size(), initial);
+
+    heap_stats stats{};
+    manager->v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 1);
+    EXPECT_EQ(stats.x_number_of_successful_allocations, blocks.size());
+    EXPECT_EQ(stats.x_number_of_successful_frees, blocks.size());
+    EXPECT_EQ(manager->allocate_aligned(0, 64), nullptr);
+    EXPECT_EQ(manager->allocate_aligned(65536, 64), nullptr);
+}
+
+TEST(TestStaticHeapAligned, AllocateAligned)
+{
+    expect_allocate_aligned<heap_mode::first_fit>();
+    expect_allocate_aligned<heap_mode::tlsf>();
+}
+
+TEST(TestStaticHeapAligned, OverAlignedTypes)
+{
+    constexpr std::size_t                     val = 16384;
+    static_heap<val>                          manager{};
+    static_heap_allocator<hot_counter, val>   alloc{manager};
+    std::vector<hot_counter, decltype(alloc)> counters{alloc};
+    std::list<hot_counter, decltype(alloc)>   list{alloc};
+    auto const                                initial = manager.free_heap_size();
+
+    for (std::uint64_t i = 0; i < 20; i++) {
+        counters.push_back({i});
+        list.push_back({i});
+        EXPECT_TRUE(is_aligned(counters.data(), 64));
+        EXPECT_TRUE(is_aligned(&list.back(), 64));
+    }
+    counters.clear();
+    counters.shrink_to_fit();
+    list.clear();
+    EXPECT_EQ(manager.free_heap_size(), initial);
+}
+
+TEST(TestStaticHeapAligned, ConcurrentHeap)
+{
+    auto  manager = std::make_unique<concurrent_heap<16384, heap_mode::tlsf>>();
+    auto* small   = manager->allocate_aligned(24, 64);
+    auto* large   = manager->allocate_aligned(1000, 256);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    EXPECT_TRUE(is_aligned(small, 64));
+    EXPECT_TRUE(is_aligned(large, 256));
+    manager->deallocate(small, 24);
+    manager->deallocate(large, 1000);
+    manager->flush();
+
+    heap_stats stats{};
+    manager->v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 1);
+}
@@ -0,0 +1,151 @@
+#include <xitren/allocators/static_heap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+
+using namespace xitren::allocators;
+
+namespace {
+
+void
+fill(void* pointer, std::size_t size, std::uint8_t seed)
+{
+    auto* bytes = static_cast<std::uint8_t*>(pointer);
+    for (std::size_t i{}; i < size; i++) {
+        bytes[i] = static_cast<std::uint8_t>(seed + i);
+    }
+}
+
+bool
+holds(void const* pointer, std::size_t size, std::uint8_t seed)
+{
+    auto const* bytes = static_cast<std::uint8_t const*>(pointer);
+    for (std::size_t i{}; i < size; i++) {
+        if (bytes[i] != static_cast<std::uint8_t>(seed + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}    // namespace
+
+template <heap_mode Mode>
+void
+expect_in_place()
+{
+    auto       manager = std::make_unique<static_heap<8192, Mode>>();
+    auto const initial = manager->free_heap_size();
+
+    auto* ptr = manager->allocate(100);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_GE(manager->usable_size(ptr), 100);
+    fill(ptr, 100, 1);
+
+    /* The rest of the heap follows the block, so it grows without moving. */
+    EXPECT_EQ(manager->reallocate(ptr, 1000), ptr);
+    EXPECT_GE(manager->usable_size(ptr), 1000);
+    EXPECT_TRUE(holds(ptr, 100, 1));
+    fill(ptr, 1000, 2);
+
+    /* Shrinking splits the tail off, and the next allocation takes it. */
+    EXPECT_EQ(manager->reallocate(ptr, 200), ptr);
+    EXPECT_TRUE(holds(ptr, 200, 2));
+    EXPECT_LT(manager->usable_size(ptr), 1000);
+    auto* after = static_cast<std::uint8_t*>(manager->allocate(300));
+    ASSERT_NE(after, nullptr);
+    EXPECT_LT(after, static_cast<std::uint8_t*>(ptr) + 1000);
+
+    /* Blocked by the allocation after it, the block moves. */
+    auto* moved = manager->reallocate(ptr, 2000);
+    ASSERT_NE(moved, nullptr);
+    EXPECT_NE(moved, ptr);
+    EXPECT_TRUE(holds(moved, 200, 2));
+
+    EXPECT_EQ(manager->reallocate(moved, 1 << 20), nullptr);
+    EXPECT_TRUE(holds(moved, 200, 2));
+
+    manager->deallocate(after);
+    EXPECT_EQ(manager->reallocate(moved, 0), nullptr);
+    EXPECT_EQ(manager->free_heap_size(), initial);
+    EXPECT_EQ(manager->usable_size(nullptr), 0);
+
+    auto* fresh = manager->reallocate(nullptr, 64);
+    ASSERT_NE(fresh, nullptr);
+    manager->deallocate(fresh);
+
+    heap_stats stats{};
+    manager->v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 1);
+}
+
+TEST(TestStaticHeapRealloc, InPlace)
+{
+    expect_in_place<heap_mode::first_fit>();
+    expect_in_place<heap_mode::tlsf>();
+}
+
+template <heap_mode Mode>
+void
+expect_random_resizes()
+{
+    auto       manager = std::make_unique<static_heap<65536, Mode>>();
+    auto const initial = manager->free_heap_size();
+
+    struct entry {
+        std::size_t  size;
+        std::uint8_t seed;
+    };
+    std::map<void*, entry>                     live;
+    std::mt19937                               gen{5};
+    std::uniform_int_distribution<std::size_t> sizes{1, 2000};
+    std::size_t                                in_place{};
+    for (int i = 0; i < 20'000; i++) {
+        auto const action = gen() % 4;
+        if (live.empty() || (action == 0)) {
+            auto const size = sizes(gen);
+            if (auto* ptr = manager->allocate(size); ptr != nullptr) {
+                auto const seed = static_cast<std::uint8_t>(gen());
+                fill(ptr, size, seed);
+                live.emplace(ptr, entry{size, seed});
+            }
+            continue;
+        }
+        auto victim       = std::next(live.begin(), static_cast<std::ptrdiff_t>(gen() % live.size()));
+        auto [ptr, state] = *victim;
+        ASSERT_TRUE(holds(ptr, state.size, state.seed));
+        live.erase(victim);
+        if (action == 1) {
+            manager->deallocate(ptr);
+            continue;
+        }
+        auto const size    = sizes(gen);
+        auto*      resized = manager->reallocate(ptr, size);
+        if (resized == nullptr) {
+            live.emplace(ptr, state);
+            continue;
+        }
+        in_place += (resized == ptr) ? 1 : 0;
+        ASSERT_GE(manager->usable_size(resized), size);
+        ASSERT_TRUE(holds(resized, std::min(size, state.size), state.seed));
+        fill(resized, size, state.seed);
+        live.emplace(resized, entry{size, state.seed});
+    }
+    EXPECT_GT(in_place, 1000);
+    for (auto [ptr, state] : live) {
+        manager->deallocate(ptr);
+    }
+    EXPECT_EQ(manager->free_heap_size(), initial);
+}
+
+TEST(TestStaticHeapRealloc, RandomResizes)
+{
+    expect_random_resizes<heap_mode::first_fit>();
+    expect_random_resizes<heap_mode::tlsf>();
+}
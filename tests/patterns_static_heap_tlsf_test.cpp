@@ -0,0 +1,178 @@
+#include <xitren/allocators/static_heap.hpp>
+#include <xitren/allocators/static_heap_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace xitren::allocators;
+
+TEST(TestStaticHeapTlsf, AllocateAndFree)
+{
+    static_heap<1024, heap_mode::tlsf> manager{};
+    auto const                         initial = manager.free_heap_size();
+
+    auto* ptr1 = manager.allocate(1);
+    auto* ptr2 = manager.allocate(100);
+    auto* ptr3 = manager.allocate(8);
+    ASSERT_NE(ptr1, nullptr);
+    ASSERT_NE(ptr2, nullptr);
+    ASSERT_NE(ptr3, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr2) % 8, 0);
+    EXPECT_LT(manager.free_heap_size(), initial);
+    EXPECT_EQ(manager.allocate(0), nullptr);
+    EXPECT_EQ(manager.allocate(2048), nullptr);
+
+    manager.deallocate(ptr2);
+    auto* ptr4 = manager.allocate(100);
+    EXPECT_EQ(ptr4, ptr2);
+
+    manager.deallocate(ptr1);
+    manager.deallocate(ptr3);
+    manager.deallocate(ptr4);
+    EXPECT_EQ(manager.free_heap_size(), initial);
+}
+
+TEST(TestStaticHeapTlsf, CoalescesNeighbours)
+{
+    static_heap<4096, heap_mode::tlsf> manager{};
+    std::vector<void*>                 blocks;
+    while (auto* ptr = manager.allocate(40)) {
+        blocks.push_back(ptr);
+    }
+    EXPECT_GT(blocks.size(), 50);
+    EXPECT_EQ(manager.allocate(40), nullptr);
+
+    /* Free every other block, then the rest: the heap has to end up as one block again. */
+    for (std::size_t i = 0; i < blocks.size(); i += 2) {
+        manager.deallocate(blocks[i]);
+    }
+    EXPECT_EQ(manager.allocate(200), nullptr);
+    for (std::size_t i = 1; i < blocks.size(); i += 2) {
+        manager.deallocate(blocks[i]);
+    }
+    static_heap<4096, heap_mode::tlsf>::heap_stats_t stats{};
+    manager.v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 1);
+    EXPECT_EQ(stats.x_size_of_largest_free_block_in_bytes, manager.free_heap_size());
+    EXPECT_EQ(stats.x_number_of_successful_allocations, blocks.size());
+    EXPECT_EQ(stats.x_number_of_successful_frees, blocks.size());
+    EXPECT_NE(manager.allocate(manager.free_heap_size() - 64), nullptr);
+}
+
+TEST(TestStaticHeapTlsf, RandomWorkloadKeepsBlocksIntact)
+{
+    static_heap<65536, heap_mode::tlsf>        manager{};
+    auto const                                 initial = manager.free_heap_size();
+    std::map<std::uint8_t*, std::size_t>       live;
+    std::mt19937                               gen{7};
+    std::uniform_int_distribution<std::size_t> sizes{1, 700};
+
+    for (int i = 0; i < 20'000; i++) {
+        if (live.empty() || (gen() % 3 != 0)) {
+            auto const size = sizes(gen);
+            auto*      ptr  = static_cast<std::uint8_t*>(manager.allocate(size));
+            if (ptr == nullptr) {
+                continue;
+            }
+            /* The new block must not overlap any live one. */
+            auto const next = live.lower_bound(ptr);
+            if (next != live.end()) {
+                ASSERT_LE(ptr + size, next->first);
+            }
+            if (next != live.begin()) {
+                ASSERT_LE(std::prev(next)->first + std::prev(next)->second, ptr);
+            }
+            std::memset(ptr, static_cast<int>(size & 0xFF), size);
+            live.emplace(ptr, size);
+        } else {
+            auto       victim  = std::next(live.begin(), static_cast<std::ptrdiff_t>(gen() % live.size()));
+            auto const pattern = static_cast<std::uint8_t>(victim->second & 0xFF);
+            ASSERT_TRUE(std::all_of(victim->first, victim->first + victim->second,
+                                    [pattern](std::uint8_t byte) { return byte == pattern; }));
+            manager.deallocate(victim->first);
+            live.erase(victim);
+        }
+    }
+    for (auto [ptr, size] : live) {
+        manager.deallocate(ptr);
+    }
+    EXPECT_EQ(manager.free_heap_size(), initial);
+    EXPECT_LT(manager.minimum_ever_free_heap_size(), initial);
+}
+
+TEST(TestStaticHeapTlsf, IgnoresDoubleFreeAndForeignPointers)
+{
+    static_heap<1024, heap_mode::tlsf> manager{};
+    int                                failures{};
+    manager.on_fail([&failures]() { failures++; });
+
+    auto* ptr = manager.allocate(16);
+    manager.deallocate(ptr);
+    auto const free_size = manager.free_heap_size();
+    manager.deallocate(ptr);
+    int foreign{};
+    manager.deallocate(&foreign);
+    EXPECT_EQ(manager.free_heap_size(), free_size);
+
+    EXPECT_EQ(manager.allocate(4096), nullptr);
+    EXPECT_EQ(failures, 1);
+}
+
+TEST(TestStaticHeapTlsf, STLContainers)
+{
+    constexpr std::size_t                                              val = 8192;
+    static_heap<val, heap_mode::tlsf>                                  manager{};
+    static_heap_allocator<int, val, heap_mode::tlsf>                   alloc{manager};
+    std::vector<int, static_heap_allocator<int, val, heap_mode::tlsf>> vec{alloc};
+    std::list<int, static_heap_allocator<int, val, heap_mode::tlsf>>   list{alloc};
+    auto const                                                         initial = manager.free_heap_size();
+
+    EXPECT_NO_THROW({
+        for (int i = 0; i < 100; ++i) {
+            vec.push_back(i);
+            list.push_front(i);
+        }
+    });
+    EXPECT_EQ(vec.size(), 100);
+    EXPECT_EQ(list.front(), 99);
+    vec.clear();
+    vec.shrink_to_fit();
+    list.clear();
+    EXPECT_EQ(manager.free_heap_size(), initial);
+}
+
+template <heap_mode Mode>
+void
+expect_stats_after_free()
+{
+    static_heap<4096, Mode> manager{};
+    auto*                   ptr1 = manager.allocate(64);
+    auto*                   ptr2 = manager.allocate(64);
+    auto*                   ptr3 = manager.allocate(64);
+    manager.deallocate(ptr2);
+
+    heap_stats stats{};
+    manager.v_port_get_heap_stats(&stats);
+    EXPECT_EQ(stats.x_number_of_free_blocks, 2);
+    EXPECT_EQ(stats.x_available_heap_space_in_bytes, manager.free_heap_size());
+    EXPECT_EQ(stats.x_minimum_ever_free_bytes_remaining, manager.minimum_ever_free_heap_size());
+    EXPECT_EQ(stats.x_number_of_successful_allocations, 3);
+    EXPECT_EQ(stats.x_number_of_successful_frees, 1);
+    EXPECT_LT(stats.x_size_of_smallest_free_block_in_bytes, stats.x_size_of_largest_free_block_in_bytes);
+    manager.deallocate(ptr1);
+    manager.deallocate(ptr3);
+}
+
+TEST(TestStaticHeapTlsf, SameStatsAsFirstFit)
+{
+    expect_stats_after_free<heap_mode::first_fit>();
+    expect_stats_after_free<heap_mode::tlsf>();
+}
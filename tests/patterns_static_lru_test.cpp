@@ -0,0 +1,73 @@
+#include <xitren/cache/lru.hpp>
+#include <xitren/cache/static_lru.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+TEST(static_lru_test, simple_check)
+{
+    static_lru<int, std::string, 8, false> inst{1s};
+    inst.put(11, "First data");
+    auto item = inst.get(11);
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::get<1>(*item), "First data");
+    EXPECT_FALSE(inst.get(12).has_value());
+}
+
+TEST(static_lru_test, evicts_least_recently_used)
+{
+    static_lru<int, int, 4, false> inst{1s};
+    for (int i = 0; i < 4; i++) {
+        inst.put(i, i * 10);
+    }
+    EXPECT_TRUE(inst.get(0).has_value());
+    EXPECT_TRUE(inst.touch(1));
+    inst.put(4, 40);
+    inst.put(5, 50);
+    EXPECT_EQ(inst.size(), 4);
+    EXPECT_EQ(std::get<1>(*inst.get(0)), 0);
+    EXPECT_EQ(std::get<1>(*inst.get(1)), 10);
+    EXPECT_FALSE(inst.get(2).has_value());
+    EXPECT_FALSE(inst.get(3).has_value());
+}
+
+TEST(static_lru_test, expired_items_are_reused)
+{
+    static_lru<int, int, 2, true> inst{10ms};
+    inst.put(1, 1);
+    inst.put(2, 2);
+    std::this_thread::sleep_for(20ms);
+    EXPECT_THROW({ inst.get(1); }, cache_timeout);
+    EXPECT_EQ(inst.size(), 1);
+    inst.put(3, 3);
+    EXPECT_EQ(inst.size(), 2);
+    EXPECT_EQ(std::get<1>(*inst.get(3)), 3);
+}
+
+TEST(static_lru_test, same_behaviour_as_lru)
+{
+    static_lru<int, int, 64, false> fixed{1h};
+    lru<int, int, 64, false>        reference{1h};
+    std::mt19937                    gen{42};
+    std::uniform_int_distribution   keys{0, 255};
+    for (int i = 0; i < 100'000; i++) {
+        auto const key = keys(gen);
+        if (i % 3) {
+            auto const a = fixed.get(key);
+            auto const b = reference.get(key);
+            ASSERT_EQ(a.has_value(), b.has_value());
+            if (a) {
+                ASSERT_EQ(std::get<1>(*a), std::get<1>(*b));
+            }
+        } else {
+            fixed.put(key, i);
+            reference.put(key, i);
+        }
+        ASSERT_EQ(fixed.size(), reference.size());
+    }
+}
@@ -0,0 +1,189 @@
+#include <xitren/allocators/concurrent_heap.hpp>
+#include <xitren/allocators/static_heap.hpp>
+#include <xitren/allocators/static_pool.hpp>
+#include <xitren/allocators/static_pool_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <new>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace xitren::allocators;
+
+TEST(TestStaticPool, SlotsWithoutHeaders)
+{
+    struct item {
+        std::uint64_t first;
+        std::uint64_t second;
+    };
+    static_assert(static_pool<item, 8>::slot_size == sizeof(item));
+    static_assert(static_pool<char, 8>::slot_size == sizeof(void*));
+
+    auto               pool = std::make_unique<static_pool<item, 8>>();
+    std::vector<item*> items;
+    while (auto* ptr = pool->allocate()) {
+        items.push_back(ptr);
+    }
+    ASSERT_EQ(items.size(), 8);
+    EXPECT_EQ(pool->free_slots(), 0);
+    for (std::size_t i = 1; i < items.size(); i++) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(items[i]) - reinterpret_cast<std::uintptr_t>(items[i - 1]),
+                  sizeof(item));
+    }
+    EXPECT_EQ(pool->allocate(), nullptr);
+}
+
+TEST(TestStaticPool, ReusesFreedSlotsFirst)
+{
+    static_pool<int, 4> pool{};
+    auto*               ptr1 = pool.allocate();
+    auto*               ptr2 = pool.allocate();
+    EXPECT_EQ(pool.size(), 2);
+
+    pool.deallocate(ptr1);
+    pool.deallocate(ptr2);
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_EQ(pool.allocate(), ptr2);
+    EXPECT_EQ(pool.allocate(), ptr1);
+
+    int foreign{};
+    EXPECT_TRUE(pool.owns(ptr1));
+    EXPECT_FALSE(pool.owns(&foreign));
+    EXPECT_FALSE(pool.owns(reinterpret_cast<char*>(ptr1) + 1));
+    pool.deallocate(&foreign);
+    pool.deallocate(nullptr);
+    EXPECT_EQ(pool.size(), 2);
+}
+
+TEST(TestStaticPool, SlotsFromHeap)
+{
+    auto       heap    = std::make_unique<static_heap<4096>>();
+    auto const initial = heap->free_heap_size();
+    {
+        static_pool<std::uint64_t, 32, static_heap<4096>> pool{*heap};
+        EXPECT_LE(heap->free_heap_size(), initial - 32 * sizeof(std::uint64_t));
+        std::vector<std::uint64_t*> items;
+        while (auto* ptr = pool.allocate()) {
+            items.push_back(ptr);
+        }
+        EXPECT_EQ(items.size(), 32);
+        EXPECT_TRUE(pool.owns(items.back()));
+        for (auto* ptr : items) {
+            pool.deallocate(ptr);
+        }
+    }
+    EXPECT_EQ(heap->free_heap_size(), initial);
+    EXPECT_THROW((static_pool<std::uint64_t, 1024, static_heap<4096>>{*heap}), std::bad_alloc);
+}
+
+TEST(TestStaticPool, NodeContainers)
+{
+    using heap_t = static_heap<65536>;
+
+    auto       heap    = std::make_unique<heap_t>();
+    auto const initial = heap->free_heap_size();
+    {
+        static_pool_set<64, heap_t> pools{*heap};
+        std::list<int, static_pool_allocator<int, 64, heap_t>> list{static_pool_allocator<int, 64, heap_t>{pools}};
+        std::set<int, std::less<>, static_pool_allocator<int, 64, heap_t>> set{
+            static_pool_allocator<int, 64, heap_t>{pools}};
+        std::map<int, int, std::less<>, static_pool_allocator<std::pair<int const, int>, 64, heap_t>> map{
+            static_pool_allocator<std::pair<int const, int>, 64, heap_t>{pools}};
+
+        for (int i = 0; i < 32; i++) {
+            list.push_back(i);
+            set.insert(i);
+            map.emplace(i, i * i);
+        }
+        EXPECT_EQ(list.size(), 32);
+        EXPECT_EQ(*set.rbegin(), 31);
+        EXPECT_EQ(map.at(5), 25);
+        EXPECT_LT(heap->free_heap_size(), initial);
+
+        /* The node slots go back to the pool with the containers. */
+        list.clear();
+        std::list<int, static_pool_allocator<int, 64, heap_t>> other{list.get_allocator()};
+        for (int i = 0; i < 64; i++) {
+            other.push_back(i);
+        }
+        EXPECT_THROW(other.push_back(64), std::bad_alloc);
+        EXPECT_EQ(other.size(), 64);
+    }
+    /* The slabs go back to the heap with the set. */
+    EXPECT_EQ(heap->free_heap_size(), initial);
+}
+
+TEST(TestStaticPool, SetsAreSeparate)
+{
+    using heap_t  = static_heap<16384>;
+    using alloc_t = static_pool_allocator<int, 8, heap_t, 1>;
+
+    auto                          heap = std::make_unique<heap_t>();
+    static_pool_set<8, heap_t, 1> first{*heap};
+    static_pool_set<8, heap_t, 1> second{*heap};
+    EXPECT_TRUE(alloc_t{first} == alloc_t{first});
+    EXPECT_TRUE(alloc_t{first} != alloc_t{second});
+    EXPECT_TRUE(alloc_t{first} == (static_pool_allocator<long, 8, heap_t, 1>{first}));
+
+    std::list<int, alloc_t> full{alloc_t{first}};
+    for (int i = 0; i < 8; i++) {
+        full.push_back(i);
+    }
+    /* Another set has slots of its own, and a set with one class takes a single node size. */
+    std::list<int, alloc_t> spare{alloc_t{second}};
+    spare.push_back(1);
+    EXPECT_THROW(full.push_back(8), std::bad_alloc);
+    std::set<int, std::less<>, alloc_t> other_node{alloc_t{first}};
+    EXPECT_THROW(other_node.insert(1), std::bad_alloc);
+}
+
+TEST(TestStaticPool, SetPerThread)
+{
+    using heap_t = concurrent_heap<1 << 20>;
+
+    auto                     heap = std::make_unique<heap_t>();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&heap, t]() {
+            static_pool_set<256, heap_t>                            pools{*heap};
+            std::list<int, static_pool_allocator<int, 256, heap_t>> list{
+                static_pool_allocator<int, 256, heap_t>{pools}};
+            for (int round = 0; round < 100; round++) {
+                for (int i = 0; i < 256; i++) {
+                    list.push_back(t);
+                }
+                EXPECT_EQ(std::count(list.begin(), list.end(), t), 256);
+                list.clear();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+TEST(TestStaticPool, ArraysAreRejected)
+{
+    using heap_t  = static_heap<16384>;
+    using alloc_t = static_pool_allocator<std::pair<int const, int>, 64, heap_t>;
+
+    auto                        heap = std::make_unique<heap_t>();
+    static_pool_set<64, heap_t> pools{*heap};
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<>, alloc_t> map{0, std::hash<int>{}, std::equal_to<>{},
+                                                                              alloc_t{pools}};
+    EXPECT_THROW(
+        {
+            for (int i = 0; i < 16; i++) {
+                map.emplace(i, i);
+            }
+        },
+        std::bad_alloc);
+}
@@ -0,0 +1,118 @@
+#include <xitren/cache/write_back_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <mutex>
+#include <span>
+#include <thread>
+
+using namespace xitren::cache;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct store {
+    std::mutex         access{};
+    std::map<int, int> data{};
+    std::size_t        calls{};
+    std::size_t        writes{};
+
+    void
+    write(std::span<std::pair<int, int> const> items)
+    {
+        std::unique_lock<std::mutex> lock(access);
+        calls++;
+        for (auto const& [key, value] : items) {
+            data[key] = value;
+            writes++;
+        }
+    }
+};
+
+auto
+sink_to(store& target)
+{
+    return [&target](std::span<std::pair<int, int> const> items) { target.write(items); };
+}
+
+}    // namespace
+
+TEST(write_back_cache_test, writes_are_coalesced)
+{
+    store backend;
+    {
+        write_back_cache<int, int, 64, decltype(sink_to(backend))> inst{1h, sink_to(backend), 16, 1.0};
+        for (int round = 0; round < 10; round++) {
+            for (int key = 0; key < 32; key++) {
+                inst.put(key, round * 100 + key);
+            }
+        }
+        EXPECT_EQ(backend.writes, 0);
+        EXPECT_EQ(inst.dirty(), 32);
+        EXPECT_EQ(std::get<1>(*inst.get(5)), 905);
+        EXPECT_EQ(inst.flush(), 32);
+        EXPECT_EQ(inst.dirty(), 0);
+        EXPECT_EQ(inst.size(), 32);
+        EXPECT_EQ(inst.flush(), 0);
+    }
+    EXPECT_EQ(backend.writes, 32);
+    EXPECT_EQ(backend.calls, 2);
+    EXPECT_EQ(backend.data[5], 905);
+}
+
+TEST(write_back_cache_test, evicted_and_expired_entries_are_written)
+{
+    store backend;
+    {
+        write_back_cache<int, int, 4, decltype(sink_to(backend))> inst{20ms, sink_to(backend), 16, 1.0};
+        for (int key = 0; key < 6; key++) {
+            inst.put(key, key);
+        }
+        EXPECT_EQ(backend.writes, 2);
+        EXPECT_EQ(backend.data.count(0), 1);
+        EXPECT_EQ(backend.data.count(1), 1);
+        std::this_thread::sleep_for(30ms);
+        EXPECT_FALSE(inst.get(2).has_value());
+        EXPECT_EQ(backend.data[2], 2);
+        EXPECT_EQ(inst.flush(), 3);
+        EXPECT_EQ(inst.size(), 0);
+    }
+    EXPECT_EQ(backend.writes, 6);
+}
+
+TEST(write_back_cache_test, flush_counts_what_reaches_the_sink)
+{
+    store backend;
+    {
+        write_back_cache<int, int, 8, decltype(sink_to(backend))> inst{20ms, sink_to(backend), 3, 1.0};
+        for (int key = 0; key < 4; key++) {
+            inst.put(key, key);
+        }
+        std::this_thread::sleep_for(30ms);
+        for (int key = 4; key < 6; key++) {
+            inst.put(key, key);
+        }
+        EXPECT_EQ(backend.writes, 0);
+        EXPECT_EQ(inst.flush(), 6);
+        EXPECT_EQ(backend.writes, 6);
+        EXPECT_EQ(inst.dirty(), 0);
+        EXPECT_EQ(inst.size(), 2);
+    }
+    EXPECT_EQ(backend.writes, 6);
+}
+
+TEST(write_back_cache_test, background_flush_on_dirty_ratio)
+{
+    store backend;
+    write_back_cache<int, int, 100, decltype(sink_to(backend))> inst{1h, sink_to(backend), 10, 0.2};
+    for (int key = 0; key < 21; key++) {
+        inst.put(key, key);
+    }
+    for (int i = 0; (i < 200) && (inst.dirty() > 10); i++) {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_LE(inst.dirty(), 10);
+    std::unique_lock<std::mutex> lock(backend.access);
+    EXPECT_GE(backend.writes, 11);
+}